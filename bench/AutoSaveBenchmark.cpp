@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "AutoSaver.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+#include "RosterJournal.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    const std::string SNAPSHOT_FILE = "bench_autosave.json";
+    const std::string JOURNAL_FILE = "bench_autosave.journal";
+    constexpr int MUTATIONS = 20000;
+
+    /** @brief Затримки мутацій: середня, 99-й перцентиль і найбільша, мс. */
+    struct Latency
+    {
+        double meanMs = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+    };
+
+    Latency Summarize(std::vector<double> seconds)
+    {
+        Latency latency;
+        if (seconds.empty()) return latency;
+        std::sort(seconds.begin(), seconds.end());
+        double total = 0.0;
+        for (const double value : seconds) total += value;
+        latency.meanMs = total / static_cast<double>(seconds.size()) * 1000.0;
+        latency.p99Ms = seconds[seconds.size() * 99 / 100] * 1000.0;
+        latency.maxMs = seconds.back() * 1000.0;
+        return latency;
+    }
+
+    /**
+     * @brief Змінює гравців, як це робить меню, і міряє кожну мутацію.
+     * Кожна 100-та мутація видаляє гравця, кожна 50-та — додає нового.
+     */
+    std::vector<double> Mutate(ClubManager& club, int playerCount, int salt)
+    {
+        std::vector<double> latencies;
+        latencies.reserve(MUTATIONS);
+        int nextNew = playerCount + salt * MUTATIONS;
+        for (int i = 0; i < MUTATIONS; ++i)
+        {
+            const int playerId = 1001 + (i * 7919 + salt) % playerCount;
+            latencies.push_back(MeasureSeconds([&]
+            {
+                if (i % 100 == 99)
+                    club.RemovePlayers(playerId);
+                else if (i % 50 == 49)
+                    club.AddPlayer(MakePlayer(nextNew++));
+                else
+                    club.ModifyPlayer(playerId, [i](Player& player)
+                    {
+                        player.SetMarketValue(300000.0 + i);
+                    });
+            }));
+        }
+        return latencies;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 200000;
+
+    FileManager fileManager;
+    double fullSaveSeconds = 0.0;
+    Latency immediate;
+    Latency deferred;
+    AutoSaveStats stats;
+    bool matches = false;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        // Журнал без автозбереження: кожна мутація чекає на запис у файл.
+        // Окремий склад, бо негайний режим блокує склад і журнал у
+        // зворотному порядку (див. RosterJournal).
+        {
+            ClubManager club("Benchmark FC", 5000000.0);
+            for (int i = 0; i < playerCount; ++i)
+                club.AddPlayer(MakePlayer(i));
+            club.AttachJournal(std::make_shared<RosterJournal>(
+                fileManager, 1000000, SNAPSHOT_FILE, JOURNAL_FILE));
+            immediate = Summarize(Mutate(club, playerCount, 1));
+        }
+
+        auto journal = std::make_shared<RosterJournal>(
+            fileManager, 1000000, SNAPSHOT_FILE, JOURNAL_FILE);
+        ClubManager club("Benchmark FC", 5000000.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakePlayer(i));
+        club.AttachJournal(journal);
+
+        // Старий шлях меню: кожне збереження пише весь склад.
+        fullSaveSeconds = MeasureSeconds([&] { journal->Compact(club); });
+
+        {
+            AutoSaver autoSaver(club, std::chrono::milliseconds(20));
+            deferred = Summarize(Mutate(club, playerCount, 2));
+            club.SetTransferBudget(4000000.0);
+            autoSaver.SaveNow();
+            autoSaver.Stop();
+            stats = autoSaver.GetStats();
+        }
+
+        // Відновлення зі знімка і журналу має дати той самий склад.
+        ClubManager recovered;
+        RosterJournal(fileManager, 1000000, SNAPSHOT_FILE, JOURNAL_FILE)
+            .Recover(recovered);
+        matches = SortedRecords(recovered.Serialize()) ==
+            SortedRecords(club.Serialize()) && club.GetDirtyCount() == 0;
+    }
+    std::cout.rdbuf(original);
+
+    for (const auto& file : {SNAPSHOT_FILE, JOURNAL_FILE})
+        std::filesystem::remove(fileManager.GetFullPath(file));
+
+    const auto print = [](const char* title, const Latency& latency)
+    {
+        std::cout << title << ": середня " << latency.meanMs << " мс, p99 "
+            << latency.p99Ms << " мс, макс. " << latency.maxMs << " мс\n";
+    };
+    std::cout << "Гравців: " << playerCount << ", мутацій: " << MUTATIONS << "\n"
+        << "Повне збереження складу: " << fullSaveSeconds * 1000.0 << " мс\n";
+    print("Мутації з негайним журналом", immediate);
+    print("Мутації з автозбереженням", deferred);
+    std::cout << "Проходів автозбереження: " << stats.saves
+        << ", останній: " << stats.lastRecords << " записів за "
+        << stats.lastSaveSeconds * 1000.0 << " мс\n"
+        << "Найдовше блокування складу автозбереженням: "
+        << stats.maxPauseSeconds * 1000.0 << " мс\n";
+
+    if (!matches || !stats.lastSaveOk)
+    {
+        std::cout << "[ПОМИЛКА] Відновлений склад не збігається з робочим.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ContractedPlayer.h"
+#include "FreeAgent.h"
+#include "Goalkeepeer.h"
+#include "SlabPool.h"
+#include "Utils.h"
+
+// Спільні заготовки бенчмарків і тестів: детерміновані гравці та замір часу.
+
+namespace FootballManagement
+{
+    /** @brief Тривалість виконання fn, с. */
+    template <typename Fn>
+    double MeasureSeconds(Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::forward<Fn>(fn)();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    /**
+     * @brief i-й гравець змішаного складу: воротарі, вільні агенти й гравці
+     * з контрактом по черзі, ID — FIRST_PLAYER_ID + i.
+     */
+    inline std::shared_ptr<Player> MakePlayer(int i)
+    {
+        const std::string name = "Гравець " + std::to_string(i);
+        const int age = 18 + i % 20;
+        const double height = 1.70 + (i % 30) / 100.0;
+        const double weight = 65 + i % 25;
+        const double value = 250000.0 + i * 10.5;
+        const auto position = static_cast<Position>(1 + i % 3);
+
+        std::shared_ptr<Player> player;
+        switch (i % 3)
+        {
+        case 0:
+            player = std::make_shared<Goalkeeper>(name, age, "Україна", "Київ",
+                                                  height, weight, value);
+            break;
+        case 1:
+            player = std::make_shared<FreeAgent>(name, age, "Україна", "Львів",
+                                                 height, weight, value,
+                                                 position, 15000.0 + i,
+                                                 "Карпати");
+            break;
+        default:
+            player = std::make_shared<ContractedPlayer>(
+                name, age, "Україна", "Одеса", height, weight, value, position,
+                20000.0 + i, "2027-06-30");
+            break;
+        }
+        player->SetPlayerId(FIRST_PLAYER_ID + i);
+        return player;
+    }
+
+    /**
+     * @brief i-й гравець однорідного складу з контрактом (в арені, як після
+     * завантаження): вартості повторюються кожні 997 гравців, ID — FIRST_PLAYER_ID + i.
+     */
+    inline std::shared_ptr<ContractedPlayer> MakeContractedPlayer(int i)
+    {
+        auto player = MakePooled<ContractedPlayer>(
+            "Гравець " + std::to_string(i), 17 + i % 20, "Україна", "Одеса",
+            1.85, 80.0, 50000.0 * (i % 997), static_cast<Position>(1 + i % 3),
+            100000.0 + 1000.0 * (i % 251), "2030-06-30");
+        player->SetPlayerId(FIRST_PLAYER_ID + i);
+        return player;
+    }
+
+    /**
+     * @brief Рядки знімка у відсортованому вигляді: журнал зберігає вміст
+     * складу, але не порядок слотів після видалень.
+     */
+    inline std::vector<std::string> SortedRecords(const std::string& text)
+    {
+        std::vector<std::string> records;
+        std::size_t begin = 0;
+        while (begin < text.size())
+        {
+            std::size_t end = text.find('\n', begin);
+            if (end == std::string::npos) end = text.size();
+            records.emplace_back(text, begin, end - begin);
+            begin = end + 1;
+        }
+        std::sort(records.begin(), records.end());
+        return records;
+    }
+
+    /**
+     * @brief i-й гравець складу зі статистикою, що зачіпає всі гілки рейтингів:
+     * воротарі з різною кількістю матчів, агенти й гравці з контрактом
+     * з атакувальною статистикою (в арені), ID — FIRST_PLAYER_ID + i.
+     */
+    inline std::shared_ptr<Player> MakeRatedPlayer(int i)
+    {
+        std::shared_ptr<Player> player;
+        const Position position = static_cast<Position>(1 + i % 3);
+        switch (i % 3)
+        {
+        case 0:
+        {
+            auto keeper = MakePooled<Goalkeeper>(
+                "Воротар " + std::to_string(i), 18 + i % 20, "Україна", "Львів",
+                1.92, 88.0, 30000.0 * (i % 503));
+            // Кожен сьомий без матчів, частина з від'ємним «сирим» рейтингом.
+            for (int m = 0; m < i % 7; ++m)
+                keeper->UpdateMatchStats((i + m) % 6, (i * 3 + m) % 11);
+            for (int c = 0; c < i % 4; ++c) keeper->RegisterCleanSheet();
+            if (i % 9 == 0) keeper->RegisterPenaltySave();
+            player = keeper;
+            break;
+        }
+        case 1:
+        {
+            auto agent = MakePooled<FreeAgent>(
+                "Агент " + std::to_string(i), 20 + i % 15, "Україна", "Київ",
+                1.78, 74.0, 40000.0 * (i % 701), position,
+                50000.0 + 100.0 * (i % 97), "Клуб " + std::to_string(i % 40));
+            agent->SetMonthWithoutClub(i % 30);
+            agent->UpdateAttackingStats(i % 13, i % 5, i % 29);
+            player = agent;
+            break;
+        }
+        default:
+        {
+            auto contracted = MakePooled<ContractedPlayer>(
+                "Гравець " + std::to_string(i), 17 + i % 20, "Україна", "Одеса",
+                1.80, 76.0, 50000.0 * (i % 997) + 0.1 * (i % 13), position,
+                100000.0 + 1000.0 * (i % 251) + 0.3 * (i % 7), "2030-06-30");
+            contracted->UpdateAttackingStats(i % 37, i % 23, i % 61);
+            player = contracted;
+            break;
+        }
+        }
+        player->SetPlayerId(FIRST_PLAYER_ID + i);
+        return player;
+    }
+}
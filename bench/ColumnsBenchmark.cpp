@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int REPEATS = 20;
+    constexpr std::size_t TOP = 10;
+
+    std::shared_ptr<Player> MakeScorer(int i)
+    {
+        std::shared_ptr<Player> player;
+        if (i % 10 == 0)
+        {
+            player = std::make_shared<Goalkeeper>(
+                "Воротар " + std::to_string(i), 18 + i % 20, "Україна", "Львів",
+                1.92, 88.0, 30000.0 * (i % 503));
+        }
+        else
+        {
+            auto field = std::make_shared<ContractedPlayer>(
+                "Гравець " + std::to_string(i), 17 + i % 20, "Україна", "Одеса",
+                1.80, 76.0, 50000.0 * (i % 997), static_cast<Position>(1 + i % 3),
+                100000.0 + 1000.0 * (i % 251), "2030-06-30");
+            field->UpdateAttackingStats(i % 37, i % 23, i % 61);
+            player = field;
+        }
+        player->SetPlayerId(FIRST_PLAYER_ID + i);
+        return player;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double objectSeconds = 0.0;
+    double columnSeconds = 0.0;
+    double objectSum = 0.0;
+    double columnSum = 0.0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+        for (int i = 0; i < playerCount; ++i)
+            roster.push_back(MakeScorer(i));
+
+        ClubManager club("Benchmark FC", 0.0);
+        for (const auto& player : roster)
+            club.AddPlayer(player);
+
+        // «Сума голів, середня вартість і десятка найкращих бомбардирів».
+        std::vector<int> expected;
+        objectSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                long long goals = 0;
+                double value = 0.0;
+                std::vector<std::pair<int, int>> scorers;
+                scorers.reserve(roster.size());
+                for (const auto& p : roster)
+                {
+                    const auto* field = dynamic_cast<const FieldPlayer*>(p.get());
+                    const int g = field ? field->GetTotalGoals() : 0;
+                    goals += g;
+                    value += p->GetMarketValue();
+                    scorers.emplace_back(-g, p->GetPlayerId());
+                }
+                const std::size_t k = std::min(TOP, scorers.size());
+                std::partial_sort(scorers.begin(), scorers.begin() + k,
+                                  scorers.end());
+                expected.clear();
+                for (std::size_t i = 0; i < k; ++i)
+                    expected.push_back(scorers[i].second);
+                objectSum = static_cast<double>(goals) + value;
+            }
+        });
+
+        std::vector<int> actual;
+        columnSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                const ColumnSummary goals = club.SummarizeColumn(RosterColumn::Goals);
+                const ColumnSummary value =
+                    club.SummarizeColumn(RosterColumn::MarketValue);
+                actual = club.Columns().TopK(RosterColumn::Goals, TOP);
+                columnSum = goals.sum + value.sum;
+            }
+        });
+
+        ok = actual == expected && objectSum == columnSum;
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Обхід об'єктів (голи, вартість, топ-" << TOP << "): "
+        << objectSeconds * 1e3 / REPEATS << " мс/прохід\n"
+        << "Стовпці RosterColumns: "
+        << columnSeconds * 1e3 / REPEATS << " мс/прохід\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Агрегати стовпців не збігаються з обходом об'єктів.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ClubManager.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr auto RUN_TIME = std::chrono::milliseconds(400);
+
+    std::shared_ptr<Player> MakePlayer(const std::string& name, int i)
+    {
+        auto player = std::make_shared<ContractedPlayer>(
+            name + " " + std::to_string(i), 17 + i % 20, "Україна", "Одеса",
+            1.85, 80.0, 50000.0 * (i % 997), static_cast<Position>(1 + i % 3),
+            100000.0 + 1000.0 * (i % 251), "2030-06-30");
+        if (i % 10 == 0) player->ReportInjury("Розтягнення", 14);
+        return player;
+    }
+
+    struct RunResult
+    {
+        std::size_t reads = 0;
+        std::size_t writes = 0;
+        bool ok = true;
+    };
+
+    /**
+     * @brief readers потоків-читачів виконують запити, поки один писач додає
+     * й видаляє гравців.
+     */
+    RunResult Run(ClubManager& club, int basePlayers, std::size_t readers)
+    {
+        std::atomic<bool> stop{false};
+        std::atomic<std::size_t> reads{0};
+        std::atomic<bool> ok{true};
+        RunResult result;
+
+        std::thread writer([&]
+        {
+            std::vector<int> added;
+            for (int i = 0; !stop.load(std::memory_order_relaxed); ++i)
+            {
+                if (added.size() < 64)
+                {
+                    auto player = MakePlayer("Новачок", i);
+                    club.AddPlayer(player);
+                    added.push_back(player->GetPlayerId());
+                }
+                else
+                {
+                    club.RemovePlayers(added.front());
+                    added.erase(added.begin());
+                }
+                ++result.writes;
+            }
+            for (const int id : added) club.RemovePlayers(id);
+        });
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < readers; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                std::size_t local = 0;
+                for (int i = static_cast<int>(t); !stop.load(std::memory_order_relaxed);
+                     i += 7, ++local)
+                {
+                    const int id = FIRST_PLAYER_ID + i % basePlayers;
+                    switch (i % 4)
+                    {
+                    case 0:
+                        // Пошук серед базових гравців: писач їх не видаляє.
+                        for (const Player* p : club.SearchByName(
+                                 "Гравець " + std::to_string(i % basePlayers), 5))
+                        {
+                            if (p->GetName().find("Гравець") == std::string::npos)
+                                ok = false;
+                        }
+                        break;
+                    case 1:
+                        if (club.FilterByStatus(PlayerStatus::Injured).size() <
+                            static_cast<std::size_t>(basePlayers / 10))
+                            ok = false;
+                        break;
+                    case 2:
+                        if (const auto p = club.FindById(id);
+                            !p || p->GetPlayerId() != id)
+                            ok = false;
+                        break;
+                    default:
+                        club.Query().WhereAge(20, 21).Limit(10).ForEach(
+                            [&ok](const Player& p)
+                            {
+                                if (p.GetAge() < 20 || p.GetAge() > 21) ok = false;
+                            });
+                        break;
+                    }
+                }
+                reads += local;
+            });
+        }
+
+        std::this_thread::sleep_for(RUN_TIME);
+        stop = true;
+        for (std::thread& thread : threads) thread.join();
+        writer.join();
+
+        result.reads = reads;
+        result.ok = ok && club.GetPlayerCount() == static_cast<std::size_t>(basePlayers);
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 100000;
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::size_t> readerCounts;
+    for (std::size_t n = 1; n <= std::max<std::size_t>(4, hardware); n *= 2)
+        readerCounts.push_back(n);
+    std::vector<RunResult> results;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Benchmark FC", 0.0);
+        for (int i = 0; i < playerCount; ++i)
+        {
+            auto player = MakePlayer("Гравець", i);
+            player->SetPlayerId(FIRST_PLAYER_ID + i);
+            club.AddPlayer(player);
+        }
+
+        for (const std::size_t readers : readerCounts)
+        {
+            results.push_back(Run(club, playerCount, readers));
+            ok = ok && results.back().ok;
+        }
+    }
+    std::cout.rdbuf(original);
+
+    const double seconds = std::chrono::duration<double>(RUN_TIME).count();
+    std::cout << "Гравців: " << playerCount << ", ядер: " << hardware << "\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        std::cout << "Читачів " << readerCounts[i] << " + 1 писач: "
+            << static_cast<long long>(results[i].reads / seconds)
+            << " запитів/с, " << static_cast<long long>(results[i].writes / seconds)
+            << " змін/с\n";
+    }
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Паралельні запити побачили неузгоджений склад.\n";
+        return 1;
+    }
+    return 0;
+}
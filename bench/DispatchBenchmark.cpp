@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "PlayerBatches.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int REPEATS = 10;
+
+    bool RanksHigher(const std::pair<double, int>& a,
+                     const std::pair<double, int>& b)
+    {
+        if (a.first != b.first) return a.first > b.first;
+        return a.second < b.second;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double partitionSeconds = 0.0;
+    double virtualSort = 0.0, batchSort = 0.0;
+    double virtualValue = 0.0, batchValue = 0.0;
+    double virtualFilter = 0.0, batchFilter = 0.0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+        for (int i = 0; i < playerCount; ++i)
+        {
+            roster.push_back(MakeRatedPlayer(i));
+            if (i % 7 == 0) roster.back()->ReportInjury("Розтягнення", 10);
+        }
+        // Перемішаний склад: типи чергуються непередбачувано, як після
+        // довгої роботи з трансферами.
+        std::shuffle(roster.begin(), roster.end(), std::mt19937(42));
+
+        std::unique_ptr<PlayerBatches> batches;
+        partitionSeconds = MeasureSeconds([&]
+        {
+            batches = std::make_unique<PlayerBatches>(roster);
+        });
+
+        std::vector<std::pair<double, int>> expectedRanking;
+        virtualSort = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                expectedRanking.clear();
+                for (const auto& p : roster)
+                    expectedRanking.emplace_back(p->CalculatePerformanceRating(),
+                                                 p->GetPlayerId());
+                std::sort(expectedRanking.begin(), expectedRanking.end(),
+                          RanksHigher);
+            }
+        });
+
+        std::vector<std::pair<double, int>> actualRanking;
+        std::vector<double> scores(batches->Size());
+        batchSort = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                batches->Ratings(scores);
+                const std::span<const int> ids = batches->PlayerIds();
+                actualRanking.clear();
+                for (std::size_t i = 0; i < scores.size(); ++i)
+                    actualRanking.emplace_back(scores[i], ids[i]);
+                std::sort(actualRanking.begin(), actualRanking.end(),
+                          RanksHigher);
+            }
+        });
+
+        // Сума по перемішаному й по розкладеному складу може відрізнятися
+        // в останніх розрядах, тому звіряються значення кожного гравця.
+        std::vector<std::pair<int, double>> expectedValues;
+        double expectedTotal = 0.0;
+        virtualValue = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                expectedTotal = 0.0;
+                for (const auto& p : roster) expectedTotal += p->CalculateValue();
+            }
+        });
+        for (const auto& p : roster)
+            expectedValues.emplace_back(p->GetPlayerId(), p->CalculateValue());
+
+        double actualTotal = 0.0;
+        batchValue = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+                actualTotal = batches->TotalValue();
+        });
+        batches->Values(scores);
+        std::vector<std::pair<int, double>> actualValues;
+        for (std::size_t i = 0; i < scores.size(); ++i)
+            actualValues.emplace_back(batches->PlayerIds()[i], scores[i]);
+
+        // «Травмовані гравці без контракту».
+        const StatusFilter filter{PlayerStatus::Injured, PlayerStatus::Contracted};
+        std::vector<int> expectedIds;
+        virtualFilter = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                expectedIds.clear();
+                for (const auto& p : roster)
+                {
+                    if (filter.Matches(p->GetStatusFlags()))
+                        expectedIds.push_back(p->GetPlayerId());
+                }
+            }
+        });
+
+        std::vector<int> actualIds;
+        batchFilter = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+                actualIds = batches->Filter(filter);
+        });
+
+        std::sort(expectedValues.begin(), expectedValues.end());
+        std::sort(actualValues.begin(), actualValues.end());
+        std::sort(expectedIds.begin(), expectedIds.end());
+        std::sort(actualIds.begin(), actualIds.end());
+        ok = actualRanking == expectedRanking && actualValues == expectedValues &&
+            actualIds == expectedIds && actualTotal > 0.0 && expectedTotal > 0.0;
+    }
+    std::cout.rdbuf(original);
+
+    const auto perPass = [](double seconds) { return seconds * 1e3 / REPEATS; };
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Розкладання на пакети (один раз): " << partitionSeconds * 1e3
+        << " мс\n"
+        << "Рейтинг + сортування: віртуально " << perPass(virtualSort)
+        << " мс, пакетами " << perPass(batchSort) << " мс\n"
+        << "Оцінка вартості: віртуально " << perPass(virtualValue)
+        << " мс, пакетами " << perPass(batchValue) << " мс\n"
+        << "Фільтр статусу: віртуально " << perPass(virtualFilter)
+        << " мс, пакетами " << perPass(batchFilter) << " мс\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Пакетні ядра не збігаються з віртуальним шляхом.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "TextFolding.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    /**
+     * @brief Попередній спосіб: ::tolower для кожного байта.
+     */
+    std::string LowerPerByte(std::string text)
+    {
+        std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+        return text;
+    }
+
+    bool CheckKnownCases()
+    {
+        struct Case
+        {
+            std::string input;
+            std::string expected;
+        };
+        const std::vector<Case> cases = {
+            {"ТРАВМОВАНИЙ ВОРОТАР", "травмований воротар"},
+            {"Травмований воротар", "травмований воротар"},
+            {"ЄВГЕН ЇЖАК ІГОР ҐАНОК", "євген їжак ігор ґанок"},
+            {"Ёлкин ЁЖ", "ёлкин ёж"},
+            {"Cristiano RONALDO", "cristiano ronaldo"},
+            {"ÉDER MÜLLER ÇAĞLAR", "éder müller çağlar"},
+            {"ΑΘΗΝΑ", "αθηνα"},
+            {"Mixed Шевченко AND Сміт 123!", "mixed шевченко and сміт 123!"},
+            {"Довге ім'я понад шістнадцять байтів: ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+             "довге ім'я понад шістнадцять байтів: abcdefghijklmnopqrstuvwxyz"},
+            {std::string("AB\xD0", 3), std::string("ab\xD0", 3)},
+            {std::string("\xFF\xFEZ", 3), std::string("\xFF\xFEz", 3)},
+            {"€ZZ", "€zz"},
+        };
+
+        bool ok = true;
+        for (const auto& c : cases)
+        {
+            if (FoldCase(c.input) != c.expected)
+            {
+                std::cout << "[ПОМИЛКА] FoldCase(\"" << c.input << "\") = \""
+                    << FoldCase(c.input) << "\"\n";
+                ok = false;
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Для ASCII результат має збігатися з ::tolower на всіх довжинах
+     * (перевіряє межі векторних блоків).
+     */
+    bool CheckAsciiAgainstTolower(std::mt19937& rng)
+    {
+        std::uniform_int_distribution<int> pickByte(1, 127);
+        for (std::size_t length = 0; length < 100; ++length)
+        {
+            for (int round = 0; round < 50; ++round)
+            {
+                std::string text(length, ' ');
+                for (char& c : text) c = static_cast<char>(pickByte(rng));
+                if (FoldCase(text) != LowerPerByte(text)) return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int nameCount = argc > 1 ? std::stoi(argv[1]) : 2000000;
+    std::mt19937 rng(11);
+
+    bool ok = CheckKnownCases();
+    if (!CheckAsciiAgainstTolower(rng))
+    {
+        std::cout << "[ПОМИЛКА] ASCII-шлях розходиться з ::tolower.\n";
+        ok = false;
+    }
+
+    const std::vector<std::string> samples = {
+        "ОЛЕКСАНДР Шевченко", "Андрій ЯРМОЛЕНКО", "Cristiano Ronaldo",
+        "KEVIN DE BRUYNE", "Травмований воротар", "Вільний агент (ДОСТУПНИЙ)",
+        "Thomas MÜLLER", "Юрій Ґалицький"};
+    std::vector<std::string> names;
+    names.reserve(nameCount);
+    for (int i = 0; i < nameCount; ++i)
+        names.push_back(samples[i % samples.size()] + " " + std::to_string(i));
+
+    std::size_t checksumOld = 0;
+    const double oldSeconds = MeasureSeconds([&]
+    {
+        for (const auto& name : names)
+            checksumOld += LowerPerByte(name).size();
+    });
+
+    std::size_t checksumNew = 0;
+    const double newSeconds = MeasureSeconds([&]
+    {
+        for (const auto& name : names)
+            checksumNew += FoldCase(name).size();
+    });
+
+    // Лише згортання, без виділення пам'яті під результат.
+    std::size_t checksumInPlace = 0;
+    std::string buffer;
+    const double inPlaceSeconds = MeasureSeconds([&]
+    {
+        for (const auto& name : names)
+        {
+            buffer.assign(name);
+            FoldCaseInPlace(buffer);
+            checksumInPlace += buffer.size();
+        }
+    });
+
+    std::cout << "Рядків: " << nameCount << "\n"
+        << "::tolower по байтах (некоректно для кирилиці): " << oldSeconds
+        << " с\n"
+        << "FoldCase: " << newSeconds << " с\n"
+        << "FoldCaseInPlace (спільний буфер): " << inPlaceSeconds << " с\n"
+        << "Співвідношення: " << oldSeconds / newSeconds << "x\n";
+
+    if (!ok || checksumOld != checksumNew || checksumNew != checksumInPlace)
+    {
+        std::cout << "[ПОМИЛКА] Перевірки FoldCase не пройдено.\n";
+        return 1;
+    }
+    return 0;
+}
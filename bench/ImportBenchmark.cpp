@@ -0,0 +1,71 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    /**
+     * @brief Імпортує playerCount гравців без ID через AddPlayer (ID видає послідовність).
+     * @return bool False, якщо послідовність видала не ті ID.
+     */
+    bool RunForSize(int playerCount)
+    {
+        std::vector<std::shared_ptr<Player>> players;
+        players.reserve(playerCount);
+
+        double seconds = 0.0;
+        bool ok = false;
+
+        std::streambuf* original = std::cout.rdbuf(nullptr);
+        for (int i = 0; i < playerCount; ++i)
+            players.push_back(std::make_shared<Goalkeeper>(
+                "Воротар " + std::to_string(i), 25, "Україна", "Київ", 1.9,
+                85.0, 1000000.0));
+        {
+            ClubManager club("Benchmark FC", 0.0);
+            seconds = MeasureSeconds([&]
+            {
+                for (const auto& player : players)
+                    club.AddPlayer(player);
+            });
+
+            const int batchStart = club.AllocateIds(100);
+            ok = club.GetPlayerCount() ==
+                static_cast<std::size_t>(playerCount) &&
+                players.back()->GetPlayerId() ==
+                FIRST_PLAYER_ID + playerCount - 1 &&
+                batchStart == FIRST_PLAYER_ID + playerCount &&
+                club.GetNextId() == batchStart + 100;
+        }
+        players.clear();
+        std::cout.rdbuf(original);
+
+        std::cout << playerCount << "\t" << seconds << " с\t"
+            << seconds * 1e9 / playerCount << " нс/гравця\n";
+        return ok;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int maxPlayers = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    std::cout << "Гравців\tAddPlayer (усього)\tНа одного гравця\n";
+    bool ok = true;
+    for (int size = 1000; size <= maxPlayers; size *= 10)
+        ok = RunForSize(size) && ok;
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Послідовність ID видала неочікувані значення.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+#include "RatingKernels.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int REPEATS = 10;
+    constexpr SimdLevel LEVELS[] = {SimdLevel::Scalar, SimdLevel::Sse2,
+                                    SimdLevel::Avx2};
+
+    bool BitwiseEqual(const std::vector<double>& a, const std::vector<double>& b)
+    {
+        return a.size() == b.size() &&
+            std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double virtualSeconds = 0.0;
+    double levelSeconds[3] = {};
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+        for (int i = 0; i < playerCount; ++i)
+            roster.push_back(MakeRatedPlayer(i));
+
+        ClubManager club("Benchmark FC", 0.0);
+        for (const auto& player : roster)
+            club.AddPlayer(player);
+
+        // Еталон — скалярні методи класів у порядку слотів.
+        std::vector<double> expected(roster.size());
+        virtualSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+                for (std::size_t i = 0; i < roster.size(); ++i)
+                    expected[i] = roster[i]->CalculateValue();
+        });
+
+        std::vector<double> expectedConversion, expectedSaves;
+        for (const auto& p : roster)
+        {
+            if (const auto* field = dynamic_cast<const FieldPlayer*>(p.get()))
+                expectedConversion.push_back(field->CalculateConversionRate());
+            else
+                expectedSaves.push_back(
+                    static_cast<const Goalkeeper*>(p.get())->CalculateSavePercentage());
+        }
+
+        const RosterColumns& columns = club.Columns();
+        for (const SimdLevel level : LEVELS)
+        {
+            if (SetSimdLevel(level) != level) continue;
+
+            std::vector<double> actual;
+            levelSeconds[static_cast<int>(level)] = MeasureSeconds([&]
+            {
+                for (int r = 0; r < REPEATS; ++r)
+                    actual = club.RevaluateRoster();
+            });
+            ok = ok && BitwiseEqual(actual, expected);
+
+            std::vector<double> conversion(columns.Size()), saves(columns.Size());
+            ConversionRates(columns.Ints(RosterColumn::Goals),
+                            columns.Ints(RosterColumn::Shots), conversion);
+            SavePercentages(columns.Ints(RosterColumn::Saves),
+                            columns.Ints(RosterColumn::GoalsConceded), saves);
+            std::vector<double> fieldConversion, keeperSaves;
+            for (std::size_t i = 0; i < columns.Size(); ++i)
+            {
+                if (columns.Positions()[i] == Position::Goalkeeper)
+                    keeperSaves.push_back(saves[i]);
+                else
+                    fieldConversion.push_back(conversion[i]);
+            }
+            ok = ok && BitwiseEqual(fieldConversion, expectedConversion) &&
+                BitwiseEqual(keeperSaves, expectedSaves);
+        }
+        SetSimdLevel(DetectSimdLevel());
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << " (найкращий рівень: "
+        << SimdLevelName(DetectSimdLevel()) << ")\n"
+        << "CalculateValue() по об'єктах: " << virtualSeconds * 1e3 / REPEATS
+        << " мс/прохід\n";
+    for (const SimdLevel level : LEVELS)
+    {
+        if (level > DetectSimdLevel()) continue;
+        std::cout << "RevaluateRoster, " << SimdLevelName(level) << ": "
+            << levelSeconds[static_cast<int>(level)] * 1e3 / REPEATS
+            << " мс/прохід\n";
+    }
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Векторні ядра не збігаються побітово зі скалярними методами.\n";
+        return 1;
+    }
+    return 0;
+}
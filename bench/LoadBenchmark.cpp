@@ -0,0 +1,130 @@
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    const std::string SNAPSHOT_FILE = "bench_load.txt";
+
+    struct ChildResult
+    {
+        bool ok = false;
+        double seconds = 0.0;
+        long peakMemoryKib = 0;
+    };
+
+    /**
+     * @brief Виконує fn в окремому процесі, щоб пік пам'яті рахувався з нуля.
+     * @param fn Повертає true у разі успіху; вивід у консоль вимкнено.
+     */
+    template <typename Fn>
+    ChildResult RunInChild(Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            std::cout.rdbuf(nullptr);
+            std::_Exit(fn() ? 0 : 1);
+        }
+
+        ChildResult result;
+        int status = 0;
+        rusage usage{};
+        if (pid < 0 || wait4(pid, &status, 0, &usage) != pid) return result;
+
+        result.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        result.ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        result.peakMemoryKib = usage.ru_maxrss;
+        return result;
+    }
+
+    std::string ReadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const auto expected = static_cast<std::size_t>(playerCount);
+    FileManager fileManager;
+
+    const ChildResult saved = RunInChild([&]
+    {
+        ClubManager club("Benchmark FC", 5000000.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakePlayer(i));
+        return fileManager.SaveToFile(SNAPSHOT_FILE, club);
+    });
+
+    // Старий шлях: усі рядки файлу у векторі, потім розбір.
+    const ChildResult lines = RunInChild([&]
+    {
+        ClubManager club;
+        club.DeserializeAllPlayers(fileManager.LoadFromFile(SNAPSHOT_FILE));
+        return club.GetPlayerCount() == expected;
+    });
+
+    const ChildResult streamed = RunInChild([&]
+    {
+        ClubManager club;
+        return fileManager.LoadSnapshot(SNAPSHOT_FILE, club) &&
+            club.GetPlayerCount() == expected;
+    });
+
+    // Лише об'єкти складу (без читання файлу) — нижня межа піку пам'яті.
+    const ChildResult objects = RunInChild([&]
+    {
+        ClubManager club("Benchmark FC", 5000000.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakePlayer(i));
+        return true;
+    });
+
+    const ChildResult roundTrip = RunInChild([&]
+    {
+        ClubManager club;
+        return fileManager.LoadSnapshot(SNAPSHOT_FILE, club) &&
+            club.Serialize() == ReadFile(fileManager.GetFullPath(SNAPSHOT_FILE));
+    });
+
+    const auto fileBytes = std::filesystem::exists(
+                               fileManager.GetFullPath(SNAPSHOT_FILE))
+                               ? std::filesystem::file_size(
+                                   fileManager.GetFullPath(SNAPSHOT_FILE))
+                               : 0;
+    std::filesystem::remove(fileManager.GetFullPath(SNAPSHOT_FILE));
+
+    std::cout << "Гравців: " << playerCount << ", розмір файлу: " << fileBytes
+        << " Б, буфер читання: " << fileManager.GetReadBufferBytes() << " Б\n"
+        << "Лише об'єкти складу: пік " << objects.peakMemoryKib << " КіБ\n"
+        << "Вектор рядків (LoadFromFile): " << lines.seconds << " с, пік "
+        << lines.peakMemoryKib << " КіБ\n"
+        << "Потокове читання (LoadSnapshot): " << streamed.seconds << " с, пік "
+        << streamed.peakMemoryKib << " КіБ\n";
+
+    if (!saved.ok || !lines.ok || !streamed.ok || !objects.ok || !roundTrip.ok)
+    {
+        std::cout << "[ПОМИЛКА] Завантажений склад не збігається зі збереженим.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int FIRST_ID = 1001;
+    constexpr int LOOKUPS = 1000000;
+
+    /**
+     * @brief Заповнює клуб і вимірює середній час FindById (влучання та промахи).
+     * @return bool False, якщо хоча б один пошук повернув хибний результат.
+     */
+    bool RunForSize(int playerCount)
+    {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> pick(FIRST_ID,
+                                                FIRST_ID + playerCount - 1);
+        std::vector<int> ids(LOOKUPS);
+        for (int& id : ids) id = pick(rng);
+
+        double hitSeconds = 0.0;
+        double missSeconds = 0.0;
+        long long found = 0;
+        long long missed = 0;
+
+        std::streambuf* original = std::cout.rdbuf(nullptr);
+        {
+            ClubManager club("Benchmark FC", 0.0);
+            for (int i = 0; i < playerCount; ++i)
+            {
+                auto keeper = std::make_shared<Goalkeeper>(
+                    "Воротар " + std::to_string(i), 25, "Україна", "Київ",
+                    1.9, 85.0, 1000000.0);
+                keeper->SetPlayerId(FIRST_ID + i);
+                club.AddPlayer(std::move(keeper));
+            }
+
+            hitSeconds = MeasureSeconds([&]
+            {
+                for (const int id : ids)
+                {
+                    const auto player = club.FindById(id);
+                    if (player && player->GetPlayerId() == id) ++found;
+                }
+            });
+            missSeconds = MeasureSeconds([&]
+            {
+                for (const int id : ids)
+                {
+                    if (!club.FindById(-id)) ++missed;
+                }
+            });
+        }
+        std::cout.rdbuf(original);
+
+        std::cout << playerCount << "\t"
+            << hitSeconds * 1e9 / LOOKUPS << " нс\t"
+            << missSeconds * 1e9 / LOOKUPS << " нс\n";
+        return found == LOOKUPS && missed == LOOKUPS;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int maxPlayers = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    std::cout << "Гравців\tFindById (є)\tFindById (немає)\n";
+    bool ok = true;
+    for (int size = 1000; size <= maxPlayers; size *= 10)
+        ok = RunForSize(size) && ok;
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] FindById повернув хибний результат.\n";
+        return 1;
+    }
+    return 0;
+}
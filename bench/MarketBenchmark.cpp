@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    std::unique_ptr<ClubManager> MakeClub(int playerCount)
+    {
+        auto club = std::make_unique<ClubManager>("Benchmark FC", 0.0);
+        for (int i = 0; i < playerCount; ++i)
+        {
+            // Дробові частки, щоб округлення ціни було помітним.
+            auto player = MakeContractedPlayer(i);
+            if (i % 11 != 0)
+                player->SetMarketValue(player->GetMarketValue() + 0.25 * (i % 11));
+            club->AddPlayer(std::move(player));
+        }
+        return club;
+    }
+
+    // «Інфляція для гравців до 25 років».
+    bool IsYoung(const Player& player) { return player.GetAge() < 25; }
+
+    /**
+     * @brief Вартості зі стовпця та зі зворотного обходу індексу мають збігатися з гравцями.
+     */
+    bool Consistent(const ClubManager& club, std::vector<double>& values)
+    {
+        const auto market = club.Columns().Doubles(RosterColumn::MarketValue);
+        values.assign(market.begin(), market.end());
+        const auto ids = club.Columns().PlayerIds();
+        for (std::size_t slot = 0; slot < ids.size(); ++slot)
+        {
+            const double actual = club.FindById(ids[slot])->GetMarketValue();
+            if (std::memcmp(&actual, &values[slot], sizeof(double)) != 0 ||
+                club.FindByMarketValue(actual, actual).empty())
+                return false;
+        }
+        return club.FindByMarketValue(0.0, 1e18).size() == ids.size();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 500000;
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    double loopSeconds = 0.0;
+    // Щонайменше 4 потоки навіть на одноядерній машині — для перевірки детермінованості.
+    const std::vector<std::size_t> threadCounts = {
+        1, std::max<std::size_t>(4, hardware)
+    };
+    std::vector<MarketAdjustmentReport> reports;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        // Еталон: цикл UpdatePlayerMarketValue з оновленням індексів на кожного гравця.
+        std::vector<double> expected;
+        {
+            auto club = MakeClub(playerCount);
+            loopSeconds = MeasureSeconds([&]
+            {
+                for (int i = 0; i < playerCount; ++i)
+                {
+                    const int playerId = FIRST_PLAYER_ID + i;
+                    if (IsYoung(*club->FindById(playerId)))
+                        club->UpdatePlayerMarketValue(playerId, 7.5);
+                }
+            });
+            ok = Consistent(*club, expected);
+        }
+
+        for (const std::size_t threads : threadCounts)
+        {
+            auto club = MakeClub(playerCount);
+            ThreadPool pool(threads);
+            reports.push_back(club->ApplyMarketAdjustment(IsYoung, 7.5, pool));
+
+            std::vector<double> actual;
+            ok = ok && Consistent(*club, actual) && actual.size() == expected.size() &&
+                std::memcmp(actual.data(), expected.data(),
+                            actual.size() * sizeof(double)) == 0;
+        }
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Цикл UpdatePlayerMarketValue: " << loopSeconds * 1e3 << " мс\n";
+    for (std::size_t i = 0; i < reports.size(); ++i)
+    {
+        const MarketAdjustmentReport& report = reports[i];
+        std::cout << "ApplyMarketAdjustment, потоків " << threadCounts[i] << ": "
+            << report.seconds * 1e3 << " мс (пакетне оновлення індексу "
+            << report.indexSeconds * 1e3 << " мс, змінено " << report.updated
+            << ")\n";
+        for (const WorkerThroughput& worker : report.workers)
+        {
+            std::cout << "    слоти від " << worker.firstSlot << ": "
+                << static_cast<long long>(worker.PlayersPerSecond())
+                << " гравців/с\n";
+        }
+    }
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Результати паралельного оновлення не збігаються з послідовним.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "SlabPool.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int SNAPSHOTS = 10000;
+
+    struct Row
+    {
+        int playerId;
+        double marketValue;
+        std::string name;
+
+        bool operator==(const Row& other) const
+        {
+            return playerId == other.playerId && name == other.name &&
+                std::memcmp(&marketValue, &other.marketValue, sizeof(double)) == 0;
+        }
+    };
+
+    std::vector<Row> Rows(const RosterSnapshot& snapshot)
+    {
+        std::vector<Row> rows;
+        rows.reserve(snapshot.Size());
+        snapshot.ForEach([&rows](const Player& player)
+        {
+            rows.push_back({player.GetPlayerId(), player.GetMarketValue(),
+                            player.GetName()});
+        });
+        return rows;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const int changes = std::max(1, playerCount / 100);
+
+    double snapshotSeconds = 0.0;
+    double writeSeconds = 0.0;
+    std::size_t clones = 0;
+    std::size_t reports = 0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Benchmark FC", 0.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakeContractedPlayer(i));
+
+        snapshotSeconds = MeasureSeconds([&]
+        {
+            for (int i = 0; i < SNAPSHOTS; ++i)
+                (void)club.Snapshot();
+        });
+
+        const RosterSnapshot before = club.Snapshot();
+        const std::vector<Row> expected = Rows(before);
+        const SquadSummary expectedSummary = before.Summarize();
+        const std::size_t liveBefore = PoolStats<ContractedPlayer>().liveNodes;
+
+        // Звіт по знімку йде паралельно зі змінами складу.
+        std::atomic<bool> stop{false};
+        std::atomic<bool> consistent{true};
+        std::thread reporter([&]
+        {
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                const SquadSummary summary = before.Summarize();
+                if (std::memcmp(&summary.totalValue, &expectedSummary.totalValue,
+                                sizeof(double)) != 0 ||
+                    summary.playerCount != expectedSummary.playerCount)
+                    consistent = false;
+                ++reports;
+            }
+        });
+
+        writeSeconds = MeasureSeconds([&]
+        {
+            for (int i = 0; i < changes; ++i)
+            {
+                const int playerId = FIRST_PLAYER_ID + (i * 97) % playerCount;
+                switch (i % 4)
+                {
+                case 0: club.UpdatePlayerMarketValue(playerId, 12.5);
+                    break;
+                case 1: club.RenamePlayer(playerId, "Перейменований " +
+                                          std::to_string(i));
+                    break;
+                case 2: club.ModifyPlayer(playerId, [](Player& player)
+                    {
+                        player.SetMarketValue(1.0);
+                    });
+                    break;
+                default: club.RemovePlayers(playerId);
+                    club.AddPlayer(MakeContractedPlayer(playerCount + i));
+                    break;
+                }
+            }
+        });
+        stop = true;
+        reporter.join();
+        clones = PoolStats<ContractedPlayer>().liveNodes - liveBefore -
+            static_cast<std::size_t>(changes / 4);
+
+        ok = consistent && Rows(before) == expected;
+
+        // Новий знімок бачить зміни: його вартості збігаються з менеджером.
+        const RosterSnapshot after = club.Snapshot();
+        ok = ok && after.Size() == club.GetPlayerCount();
+        after.ForEach([&](const Player& player)
+        {
+            const auto current = club.FindById(player.GetPlayerId());
+            if (!current || current.get() != &player) ok = false;
+        });
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Snapshot(): " << snapshotSeconds * 1e6 / SNAPSHOTS << " мкс\n"
+        << "Змін після знімка: " << changes << " за " << writeSeconds * 1e3
+        << " мс, скопійовано гравців: " << clones << "\n"
+        << "Звітів по знімку під час змін: " << reports << "\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Знімок побачив зміни, зроблені після нього.\n";
+        return 1;
+    }
+    return 0;
+}
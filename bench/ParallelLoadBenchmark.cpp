@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+#include "RecordSources.h"
+#include "ThreadPool.h"
+
+using namespace FootballManagement;
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::string text;
+    std::string expected;
+    double sequentialSeconds = 0.0;
+    std::vector<std::pair<std::size_t, double>> parallelSeconds;
+    bool matches = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        {
+            ClubManager source("Benchmark FC", 5000000.0);
+            for (int i = 0; i < playerCount; ++i)
+                source.AddPlayer(MakePlayer(i));
+            text = source.Serialize();
+        }
+        // Повторний ID і пошкоджений запис посередині файлу: обидва
+        // завантажувачі мають пропустити їх однаково.
+        const std::size_t middle = text.find('\n', text.size() / 2) + 1;
+        const std::size_t firstRecord = text.find('\n') + 1;
+        text.insert(middle, text.substr(firstRecord,
+                                        text.find('\n', firstRecord) + 1 - firstRecord) +
+                    "\"type\":\"Goalkeeper\",\"id\":broken\n");
+
+        ClubManager sequential;
+        sequentialSeconds = MeasureSeconds([&]
+        {
+            LineRange lines(text);
+            sequential.DeserializeAllPlayers(lines);
+        });
+        expected = sequential.Serialize();
+
+        for (std::size_t threads = 1; threads <= cores; threads *= 2)
+        {
+            ThreadPool pool(threads);
+            ClubManager parallel;
+            parallelSeconds.emplace_back(threads, MeasureSeconds([&]
+            {
+                parallel.DeserializeAllPlayersParallel(text, pool);
+            }));
+            matches = matches && parallel.Serialize() == expected &&
+                parallel.GetPlayerCount() == static_cast<std::size_t>(playerCount);
+        }
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << ", ядер: " << cores << "\n"
+        << "Послідовно: " << sequentialSeconds << " с\n";
+    for (const auto& [threads, seconds] : parallelSeconds)
+        std::cout << "Паралельно, потоків " << threads << ": " << seconds
+            << " с (прискорення " << sequentialSeconds / seconds << "x)\n";
+
+    if (!matches)
+    {
+        std::cout << "[ПОМИЛКА] Паралельне завантаження дало інший склад.\n";
+        return 1;
+    }
+    return 0;
+}
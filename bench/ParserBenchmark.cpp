@@ -0,0 +1,183 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "Goalkeepeer.h"
+#include "RecordParser.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    /**
+     * @brief Спільні поля гравця, у які розбирають обидва варіанти парсера.
+     */
+    struct BaseFields
+    {
+        int id = 0;
+        std::string name;
+        int age = 0;
+        std::string nationality;
+        std::string origin;
+        double height = 0.0;
+        double weight = 0.0;
+        double value = 0.0;
+        bool injured = false;
+    };
+
+    /**
+     * @brief Попередня реалізація Player::DeserializeBase (std::regex + stoi/stod).
+     */
+    void ParseWithRegex(const std::string& json, BaseFields& out)
+    {
+        std::regex r("\"(.*?)\":\"?(.*?)\"?(,|})");
+        auto begin = std::sregex_iterator(json.begin(), json.end(), r);
+        auto end = std::sregex_iterator();
+
+        for (auto it = begin; it != end; ++it)
+        {
+            std::string key = (*it)[1];
+            std::string value = (*it)[2];
+
+            if (key == "name") out.name = value;
+            else if (key == "nationality") out.nationality = value;
+            else if (key == "origin") out.origin = value;
+            else if (key == "age") out.age = std::stoi(value);
+            else if (key == "height") out.height = std::stod(value);
+            else if (key == "weight") out.weight = std::stod(value);
+            else if (key == "value") out.value = std::stod(value);
+            else if (key == "id") out.id = std::stoi(value);
+            else if (key == "injured") out.injured = (value == "true");
+        }
+    }
+
+    /**
+     * @brief Новий шлях: RecordParser + switch за хешем ключа.
+     */
+    void ParseWithTokenizer(std::string_view json, BaseFields& out)
+    {
+        RecordParser parser(json);
+        RecordField field;
+        while (parser.Next(field))
+        {
+            switch (HashKey(field.key))
+            {
+            case HashKey("id"): out.id = RecordParser::ParseInt(field.value);
+                break;
+            case HashKey("name"): out.name.assign(field.value);
+                break;
+            case HashKey("age"): out.age = RecordParser::ParseInt(field.value);
+                break;
+            case HashKey("nationality"): out.nationality.assign(field.value);
+                break;
+            case HashKey("origin"): out.origin.assign(field.value);
+                break;
+            case HashKey("height"):
+                out.height = RecordParser::ParseDouble(field.value);
+                break;
+            case HashKey("weight"):
+                out.weight = RecordParser::ParseDouble(field.value);
+                break;
+            case HashKey("value"):
+                out.value = RecordParser::ParseDouble(field.value);
+                break;
+            case HashKey("injured"):
+                out.injured = RecordParser::ParseBool(field.value);
+                break;
+            default: break;
+            }
+        }
+    }
+
+    std::string MakeRecord(int i)
+    {
+        std::stringstream ss;
+        ss << "\"id\":" << 1001 + i << ","
+            << "\"name\":\"Гравець " << i << "\","
+            << "\"age\":" << 18 + i % 20 << ","
+            << "\"nationality\":\"Україна\","
+            << "\"origin\":\"Київ\","
+            << "\"height\":" << 1.70 + (i % 30) / 100.0 << ","
+            << "\"weight\":" << 65 + i % 25 << ","
+            << "\"value\":" << 250000.0 + i * 10.5 << ","
+            << "\"injured\":" << (i % 7 == 0 ? "true" : "false");
+        return ss.str();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int recordCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+    const auto path = std::filesystem::temp_directory_path() /
+        "parser_bench.json";
+
+    {
+        std::ofstream file(path);
+        for (int i = 0; i < recordCount; ++i)
+            file << MakeRecord(i) << "\n";
+    }
+
+    std::vector<std::string> lines;
+    lines.reserve(recordCount);
+    {
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+            lines.push_back(line);
+    }
+    std::filesystem::remove(path);
+
+    long long regexChecksum = 0;
+    const double regexSeconds = MeasureSeconds([&]
+    {
+        BaseFields fields;
+        for (const auto& line : lines)
+        {
+            ParseWithRegex(line, fields);
+            regexChecksum += fields.id + fields.age;
+        }
+    });
+
+    long long tokenChecksum = 0;
+    const double tokenSeconds = MeasureSeconds([&]
+    {
+        BaseFields fields;
+        for (const auto& line : lines)
+        {
+            ParseWithTokenizer(line, fields);
+            tokenChecksum += fields.id + fields.age;
+        }
+    });
+
+    // Повний шлях через Player::DeserializeBase (без налагоджувального виводу).
+    long long playerChecksum = 0;
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    const double playerSeconds = MeasureSeconds([&]
+    {
+        Goalkeeper keeper;
+        for (const auto& line : lines)
+        {
+            keeper.Deserialize(line);
+            playerChecksum += keeper.GetPlayerId() + keeper.GetAge();
+        }
+    });
+    std::cout.rdbuf(original);
+
+    std::cout << "Записів: " << lines.size() << "\n"
+        << "std::regex:              " << regexSeconds << " с\n"
+        << "RecordParser:            " << tokenSeconds << " с\n"
+        << "Goalkeeper::Deserialize: " << playerSeconds << " с\n"
+        << "Прискорення:             " << regexSeconds / tokenSeconds << "x\n";
+
+    if (regexChecksum != tokenChecksum || tokenChecksum != playerChecksum)
+    {
+        std::cout << "[ПОМИЛКА] Результати розбору не збігаються.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "BenchFixtures.h"
+#include "ContractedPlayer.h"
+#include "SlabPool.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    /** @brief Байти, зайняті в купі (0, якщо платформа цього не повідомляє). */
+    std::size_t HeapInUse()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+        return mallinfo2().uordblks;
+#else
+        return 0;
+#endif
+    }
+
+    template <typename Make>
+    void Fill(std::vector<std::shared_ptr<Player>>& roster, int count, Make make)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            roster.push_back(make());
+            roster.back()->SetPlayerId(FIRST_PLAYER_ID + i);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double heapSeconds = 0.0;
+    double poolSeconds = 0.0;
+    double heapBytes = 0.0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+
+        const std::size_t before = HeapInUse();
+        heapSeconds = MeasureSeconds([&]
+        {
+            Fill(roster, playerCount,
+                 [] { return std::make_shared<ContractedPlayer>(); });
+        });
+        heapBytes = static_cast<double>(HeapInUse() - before);
+        roster.clear();
+
+        poolSeconds = MeasureSeconds([&]
+        {
+            Fill(roster, playerCount,
+                 [] { return MakePooled<ContractedPlayer>(); });
+        });
+        for (int i = 0; i < playerCount; ++i)
+            ok = ok && roster[i]->GetPlayerId() == FIRST_PLAYER_ID + i;
+    }
+    std::cout.rdbuf(original);
+
+    // Після знищення гравців усі вузли арени мають повернутися.
+    const SlabStats stats = PoolStats<ContractedPlayer>();
+    ok = ok && stats.liveNodes == 0;
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "std::make_shared: " << heapSeconds * 1e3 << " мс";
+    if (heapBytes > 0)
+        std::cout << ", " << heapBytes / playerCount << " байт/гравця";
+    std::cout << "\nMakePooled: " << poolSeconds * 1e3 << " мс, "
+        << static_cast<double>(stats.nodeSize) << " байт/гравця, "
+        << stats.slabCount << " виділень плит\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Арена повернула некоректні вузли.\n";
+        return 1;
+    }
+    return 0;
+}
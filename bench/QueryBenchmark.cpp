@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int REPEATS = 20;
+    constexpr std::size_t TOP = 20;
+
+    std::shared_ptr<Player> MakeQueryPlayer(int i)
+    {
+        const std::string name = "Гравець " + std::to_string(i);
+        const int age = 17 + i % 20;
+        const double value = 100000.0 * (i % 97);
+        std::shared_ptr<Player> player;
+        if (i % 4 == 0)
+        {
+            player = std::make_shared<Goalkeeper>(name, age, "Україна", "Київ",
+                                                  1.9, 85.0, value);
+        }
+        else
+        {
+            auto contracted = std::make_shared<ContractedPlayer>(
+                name, age, i % 3 == 0 ? "Польща" : "Україна", "Одеса", 1.85,
+                80.0, value, static_cast<Position>(1 + i % 3), 300000.0,
+                "2030-06-30");
+            if (i % 5 == 0) contracted->ListForTransfer(1500000.0, "Без умов");
+            player = contracted;
+        }
+        if (i % 13 == 0) player->ReportInjury("Розтягнення", 14);
+        player->SetPlayerId(FIRST_PLAYER_ID + i);
+        return player;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double chainSeconds = 0.0;
+    double querySeconds = 0.0;
+    double countSeconds = 0.0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Benchmark FC", 0.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakeQueryPlayer(i));
+
+        // Попередній підхід: кожен крок фільтра матеріалізує новий вектор,
+        // далі повне сортування за вартістю.
+        std::vector<int> expected;
+        chainSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                auto listed = club.FilterByStatus(PlayerStatus::ListedForTransfer,
+                                                  PlayerStatus::Injured);
+                std::vector<Player*> young;
+                std::copy_if(listed.begin(), listed.end(),
+                             std::back_inserter(young), [](const auto& p)
+                             {
+                                 return p->GetAge() >= 18 && p->GetAge() <= 23;
+                             });
+                std::vector<Player*> midfield;
+                std::copy_if(young.begin(), young.end(),
+                             std::back_inserter(midfield), [](const auto& p)
+                             {
+                                 return p->GetPosition() == Position::Midfielder;
+                             });
+                std::stable_sort(midfield.begin(), midfield.end(),
+                                 [](const auto& a, const auto& b)
+                                 {
+                                     return a->GetMarketValue() >
+                                         b->GetMarketValue();
+                                 });
+                expected.clear();
+                for (std::size_t i = 0; i < std::min(TOP, midfield.size()); ++i)
+                    expected.push_back(midfield[i]->GetPlayerId());
+            }
+        });
+
+        std::vector<int> actual;
+        querySeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                actual = club.Query()
+                             .WhereStatus(PlayerStatus::ListedForTransfer)
+                             .WhereInjured(false)
+                             .WhereAge(18, 23)
+                             .WherePosition(Position::Midfielder)
+                             .OrderBy(QueryOrder::MarketValue, true)
+                             .Limit(TOP)
+                             .Ids();
+            }
+        });
+
+        std::size_t count = 0;
+        countSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+                count = club.Query().WhereStatus("травм").Count();
+        });
+
+        ok = actual == expected &&
+            count == club.FilterByStatus(PlayerStatus::Injured).size();
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Ланцюжок FilterByStatus + copy_if + sort: "
+        << chainSeconds * 1e3 / REPEATS << " мс/запит\n"
+        << "RosterQuery (статус, вік, позиція, top-" << TOP << "): "
+        << querySeconds * 1e3 / REPEATS << " мс/запит\n"
+        << "RosterQuery::Count за статусом: "
+        << countSeconds * 1e3 / REPEATS << " мс/запит\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Результати запиту не збігаються з ланцюжком фільтрів.\n";
+        return 1;
+    }
+    return 0;
+}
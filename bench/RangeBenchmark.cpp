@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int REPEATS = 200;
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double scanSeconds = 0.0;
+    double indexSeconds = 0.0;
+    double salarySeconds = 0.0;
+    std::size_t hits = 0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+        for (int i = 0; i < playerCount; ++i)
+            roster.push_back(MakeContractedPlayer(i));
+
+        ClubManager club("Benchmark FC", 0.0);
+        for (const auto& player : roster)
+            club.AddPlayer(player);
+
+        // «Усі захисники до 23 років вартістю від 2 до 5 млн».
+        std::vector<int> expected;
+        scanSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                expected.clear();
+                for (const auto& p : roster)
+                {
+                    if (p->GetPosition() == Position::Defender &&
+                        p->GetAge() < 23 && p->GetMarketValue() >= 2000000.0 &&
+                        p->GetMarketValue() <= 5000000.0)
+                        expected.push_back(p->GetPlayerId());
+                }
+            }
+        });
+
+        std::vector<int> actual;
+        indexSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+            {
+                actual = club.Query()
+                             .WherePosition(Position::Defender)
+                             .WhereAge(0, 22)
+                             .WhereValue(2000000.0, 5000000.0)
+                             .Ids();
+            }
+        });
+
+        salarySeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REPEATS; ++r)
+                hits = club.FindBySalary(300000.0, 301000.0).size();
+        });
+
+        std::sort(actual.begin(), actual.end());
+        ok = actual == expected;
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Повний перебір (захисники < 23, 2–5 млн): "
+        << scanSeconds * 1e3 / REPEATS << " мс/запит\n"
+        << "RosterQuery через індекс вартості: "
+        << indexSeconds * 1e3 / REPEATS << " мс/запит\n"
+        << "FindBySalary (вузький діапазон, " << hits << " гравців): "
+        << salarySeconds * 1e3 / REPEATS << " мс/запит\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Результати індексу не збігаються з повним перебором.\n";
+        return 1;
+    }
+    return 0;
+}
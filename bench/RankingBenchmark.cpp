@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr std::size_t TOP_K = 10;
+    constexpr int WARM_QUERIES = 1000;
+
+    std::shared_ptr<Player> MakeKeeper(int i)
+    {
+        auto keeper = std::make_shared<Goalkeeper>(
+            "Воротар " + std::to_string(i), 25, "Україна", "Київ", 1.9, 85.0,
+            1000000.0);
+        keeper->SetPlayerId(FIRST_PLAYER_ID + i);
+        for (int match = 0; match < 1 + i % 5; ++match)
+            keeper->UpdateMatchStats((i * 7 + match) % 4, (i * 13 + match) % 9);
+        return keeper;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double oldSortSeconds = 0.0;
+    double coldSeconds = 0.0;
+    double warmSeconds = 0.0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+        for (int i = 0; i < playerCount; ++i)
+            roster.push_back(MakeKeeper(i));
+
+        ClubManager club("Benchmark FC", 0.0);
+        for (const auto& player : roster)
+            club.AddPlayer(player);
+
+        // Попередня реалізація: повне сортування з двома віртуальними
+        // викликами на кожне порівняння.
+        oldSortSeconds = MeasureSeconds([&]
+        {
+            std::sort(roster.begin(), roster.end(),
+                      [](const auto& a, const auto& b)
+                      {
+                          return a->CalculatePerformanceRating() > b->
+                              CalculatePerformanceRating();
+                      });
+        });
+
+        std::vector<Player*> top;
+        coldSeconds = MeasureSeconds([&] { top = club.TopPerformers(TOP_K); });
+        warmSeconds = MeasureSeconds([&]
+        {
+            for (int i = 0; i < WARM_QUERIES; ++i)
+                top = club.TopPerformers(TOP_K);
+        });
+
+        for (std::size_t i = 0; i < top.size(); ++i)
+            ok = ok && top[i]->CalculatePerformanceRating() ==
+                roster[i]->CalculatePerformanceRating();
+        ok = ok && top.size() == std::min<std::size_t>(TOP_K, roster.size());
+    }
+    std::cout.rdbuf(original);
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "std::sort з віртуальними викликами: " << oldSortSeconds * 1e3
+        << " мс\n"
+        << "TopPerformers(" << TOP_K << "), побудова рейтингу: "
+        << coldSeconds * 1e3 << " мс\n"
+        << "TopPerformers(" << TOP_K << "), кешований: "
+        << warmSeconds * 1e6 / WARM_QUERIES << " мкс\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Рейтинг не збігається з повним сортуванням.\n";
+        return 1;
+    }
+    return 0;
+}
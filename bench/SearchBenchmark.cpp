@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "NameIndex.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int QUERIES = 20000;
+    constexpr int VERIFIED_QUERIES = 200;
+    constexpr std::size_t RESULT_LIMIT = 50;
+
+    const std::vector<std::string> LATIN_CONSONANTS = {
+        "b", "c", "d", "f", "g", "h", "j", "k", "l", "m", "n", "p", "r", "s",
+        "t", "v", "z", "ch", "sh", "tr"};
+    const std::vector<std::string> LATIN_VOWELS = {"a", "e", "i", "o", "u",
+                                                   "ia"};
+    const std::vector<std::string> LATIN_SUFFIXES = {"", "son", "ez", "ini",
+                                                     "ov", "ski", "er"};
+    const std::vector<std::string> CYRILLIC_CONSONANTS = {
+        "б", "в", "г", "д", "ж", "з", "к", "л", "м", "н", "п", "р", "с", "т",
+        "ф", "х", "ц", "ч", "ш", "щ"};
+    const std::vector<std::string> CYRILLIC_VOWELS = {"а", "е", "и", "і", "о",
+                                                      "у", "ю", "я"};
+    const std::vector<std::string> CYRILLIC_SUFFIXES = {"", "енко", "ський",
+                                                        "ук", "ич", "ов",
+                                                        "ишин"};
+
+    const std::string& Pick(const std::vector<std::string>& options,
+                            std::mt19937& rng)
+    {
+        std::uniform_int_distribution<std::size_t> pick(0, options.size() - 1);
+        return options[pick(rng)];
+    }
+
+    /**
+     * @brief Генерує слово зі складів "приголосна + голосна" (2-4 склади).
+     */
+    std::string MakeWord(std::mt19937& rng, bool cyrillic, bool withSuffix)
+    {
+        const int syllables = std::uniform_int_distribution<int>(2, 4)(rng);
+        std::string word;
+        for (int i = 0; i < syllables; ++i)
+        {
+            word += Pick(cyrillic ? CYRILLIC_CONSONANTS : LATIN_CONSONANTS, rng);
+            word += Pick(cyrillic ? CYRILLIC_VOWELS : LATIN_VOWELS, rng);
+        }
+        if (withSuffix)
+            word += Pick(cyrillic ? CYRILLIC_SUFFIXES : LATIN_SUFFIXES, rng);
+        return word;
+    }
+
+    std::string MakeName(std::mt19937& rng)
+    {
+        const bool cyrillic = rng() % 2 == 0;
+        return MakeWord(rng, cyrillic, false) + " " +
+            MakeWord(rng, cyrillic, true);
+    }
+
+    /**
+     * @brief Обрізає рядок UTF-8 до maxBytes, не розриваючи символи.
+     */
+    std::string TruncateUtf8(const std::string& text, std::size_t maxBytes)
+    {
+        std::size_t end = 0;
+        while (end < text.size())
+        {
+            const auto lead = static_cast<unsigned char>(text[end]);
+            const std::size_t length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 :
+                lead < 0xF0 ? 3 : 4;
+            if (end + length > maxBytes) break;
+            end += length;
+        }
+        return text.substr(0, end);
+    }
+
+    /**
+     * @brief Попередня реалізація SearchByName: перетворення регістру на кожен виклик.
+     */
+    std::vector<int> ScanSearch(const std::vector<std::string>& names,
+                                const std::string& query)
+    {
+        std::string lowerQuery = query;
+        std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(),
+                       ::tolower);
+        std::vector<int> found;
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            std::string name = names[i];
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            if (name.find(lowerQuery) != std::string::npos)
+                found.push_back(static_cast<int>(i) + 1);
+        }
+        return found;
+    }
+
+    double Percentile(std::vector<double> samples, double p)
+    {
+        std::sort(samples.begin(), samples.end());
+        return samples[static_cast<std::size_t>(p * (samples.size() - 1))];
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int nameCount = argc > 1 ? std::stoi(argv[1]) : 2000000;
+    std::mt19937 rng(7);
+
+    std::vector<std::string> names;
+    names.reserve(nameCount);
+    for (int i = 0; i < nameCount; ++i)
+        names.push_back(MakeName(rng));
+
+    NameIndex index;
+    index.Reserve(names.size());
+    const auto buildStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < nameCount; ++i)
+        index.Insert(i + 1, names[i]);
+    const double buildSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - buildStart).count();
+
+    // Пошук під час набору: префікси прізвищ довжиною 3..12 байтів.
+    std::uniform_int_distribution<int> pickName(0, nameCount - 1);
+    std::uniform_int_distribution<std::size_t> pickLength(3, 12);
+    std::vector<std::string> queries;
+    queries.reserve(QUERIES);
+    for (int q = 0; q < QUERIES; ++q)
+    {
+        const std::string& name = names[pickName(rng)];
+        queries.push_back(TruncateUtf8(name.substr(name.find(' ') + 1),
+                                       pickLength(rng)));
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(QUERIES);
+    std::size_t totalResults = 0;
+    for (const auto& query : queries)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::vector<int> ids = index.Search(query, RESULT_LIMIT);
+        latencies.push_back(std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count());
+        totalResults += ids.size();
+    }
+
+    // Повні результати індексу мають збігатися з попереднім повним переглядом.
+    bool ok = true;
+    double scanSeconds = 0.0;
+    for (int q = 0; q < VERIFIED_QUERIES; ++q)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::vector<int> expected = ScanSearch(names, queries[q]);
+        scanSeconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        ok = ok && index.Search(queries[q]) == expected;
+    }
+
+    std::cout << "Імен: " << nameCount << ", побудова індексу: "
+        << buildSeconds << " с\n"
+        << "Запитів: " << QUERIES << " (до " << RESULT_LIMIT
+        << " результатів), у середньому знайдено "
+        << totalResults / QUERIES << "\n"
+        << "NameIndex::Search  p50: " << Percentile(latencies, 0.50) * 1e6
+        << " мкс, p99: " << Percentile(latencies, 0.99) * 1e6 << " мкс\n"
+        << "Повний перегляд з tolower (попередній SearchByName): "
+        << scanSeconds * 1e3 / VERIFIED_QUERIES << " мс на запит\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Результати індексу не збігаються з переглядом.\n";
+        return 1;
+    }
+    return 0;
+}
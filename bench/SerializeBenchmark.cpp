@@ -0,0 +1,122 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "OutputBuffer.h"
+#include "RosterSnapshot.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount{0};
+}
+
+// Глобальні оператори рахують виділення пам'яті в усій програмі.
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+namespace
+{
+    /** @brief Кількість виділень пам'яті під час виконання fn. */
+    template <typename Fn>
+    std::size_t CountAllocations(Fn&& fn)
+    {
+        const std::size_t before = allocationCount.load();
+        fn();
+        return allocationCount.load() - before;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double stringSeconds = 0.0;
+    double bufferSeconds = 0.0;
+    std::size_t stringAllocations = 0;
+    std::size_t bufferAllocations = 0;
+    std::size_t bytes = 0;
+    bool matches = false;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Benchmark FC", 5000000.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakePlayer(i));
+        const RosterSnapshot roster = club.Snapshot();
+
+        // Старий шлях: окремий рядок на кожного гравця.
+        std::string joined;
+        stringAllocations = CountAllocations([&]
+        {
+            stringSeconds = MeasureSeconds([&]
+            {
+                roster.ForEach([&](const Player& player)
+                {
+                    joined += player.Serialize();
+                    joined += '\n';
+                });
+            });
+        });
+
+        // Новий шлях: усі записи в один буфер, що перевикористовується.
+        // Перший прохід розганяє місткість, вимірюється другий.
+        OutputBuffer buffer;
+        const auto appendAll = [&]
+        {
+            buffer.Clear();
+            roster.ForEach([&](const Player& player)
+            {
+                player.AppendTo(buffer);
+                buffer.Append('\n');
+            });
+        };
+        appendAll();
+        bufferAllocations = CountAllocations([&]
+        {
+            bufferSeconds = MeasureSeconds(appendAll);
+        });
+
+        bytes = buffer.Size();
+        matches = buffer.View() == joined;
+
+        // Повний знімок клубу має збігатися з тим самим шляхом через Serialize().
+        OutputBuffer snapshot;
+        club.AppendTo(snapshot);
+        matches = matches && snapshot.View() == club.Serialize();
+    }
+    std::cout.rdbuf(original);
+
+    const auto perRecord = [playerCount](std::size_t allocations)
+    {
+        return playerCount == 0 ? 0.0
+                                : static_cast<double>(allocations) / playerCount;
+    };
+
+    std::cout << "Гравців: " << playerCount << ", байтів: " << bytes << "\n"
+        << "Serialize() на гравця: " << stringSeconds << " с, виділень на запис "
+        << perRecord(stringAllocations) << "\n"
+        << "AppendTo у спільний буфер: " << bufferSeconds
+        << " с, виділень на запис " << perRecord(bufferAllocations) << "\n"
+        << "Прискорення: " << stringSeconds / bufferSeconds << "x\n";
+
+    if (!matches)
+    {
+        std::cout << "[ПОМИЛКА] Результати серіалізації не збігаються.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    const std::string TEXT_SNAPSHOT = "bench_snapshot.txt";
+    const std::string BINARY_SNAPSHOT = "bench_snapshot.bin";
+    const std::string CONVERTED_SNAPSHOT = "bench_snapshot_converted.txt";
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    FileManager fileManager;
+    double textSaveSeconds = 0.0;
+    double textLoadSeconds = 0.0;
+    double binarySaveSeconds = 0.0;
+    double binaryLoadSeconds = 0.0;
+    bool textMatches = false;
+    bool binaryMatches = false;
+    bool converted = false;
+
+    // Конструктори, деструктори та завантаження пишуть у консоль — вимикаємо
+    // вивід, доки живуть усі об'єкти гравців.
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager source("Benchmark FC", 5000000.0);
+        for (int i = 0; i < playerCount; ++i)
+            source.AddPlayer(MakePlayer(i));
+
+        ClubManager textCopy;
+        ClubManager binaryCopy;
+        ClubManager buffer;
+
+        fileManager.SetSnapshotFormat(SnapshotFormat::Text);
+        textSaveSeconds = MeasureSeconds([&]
+        {
+            fileManager.SaveSnapshot(TEXT_SNAPSHOT, source);
+        });
+        textLoadSeconds = MeasureSeconds([&]
+        {
+            fileManager.LoadSnapshot(TEXT_SNAPSHOT, textCopy);
+        });
+
+        fileManager.SetSnapshotFormat(SnapshotFormat::Binary);
+        binarySaveSeconds = MeasureSeconds([&]
+        {
+            fileManager.SaveSnapshot(BINARY_SNAPSHOT, source);
+        });
+        binaryLoadSeconds = MeasureSeconds([&]
+        {
+            fileManager.LoadSnapshot(BINARY_SNAPSHOT, binaryCopy);
+        });
+
+        converted = fileManager.ConvertSnapshot(
+            BINARY_SNAPSHOT, CONVERTED_SNAPSHOT, SnapshotFormat::Text, buffer);
+
+        const std::string expected = source.Serialize();
+        textMatches = textCopy.Serialize() == expected;
+        binaryMatches = binaryCopy.Serialize() == expected;
+    }
+    std::cout.rdbuf(original);
+
+    const auto textBytes = std::filesystem::file_size(
+        fileManager.GetFullPath(TEXT_SNAPSHOT));
+    const auto binaryBytes = std::filesystem::file_size(
+        fileManager.GetFullPath(BINARY_SNAPSHOT));
+
+    const bool convertedMatches = converted &&
+        std::filesystem::file_size(fileManager.GetFullPath(CONVERTED_SNAPSHOT))
+        == textBytes;
+
+    for (const auto& file : {TEXT_SNAPSHOT, BINARY_SNAPSHOT, CONVERTED_SNAPSHOT})
+        std::filesystem::remove(fileManager.GetFullPath(file));
+
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "Текст:   збереження " << textSaveSeconds << " с, завантаження "
+        << textLoadSeconds << " с, розмір " << textBytes << " Б\n"
+        << "Бінарний: збереження " << binarySaveSeconds
+        << " с, завантаження " << binaryLoadSeconds << " с, розмір "
+        << binaryBytes << " Б\n"
+        << "Прискорення завантаження: " << textLoadSeconds / binaryLoadSeconds
+        << "x, стиснення: " << static_cast<double>(textBytes) / binaryBytes
+        << "x\n";
+
+    if (!textMatches || !binaryMatches || !convertedMatches)
+    {
+        std::cout << "[ПОМИЛКА] Знімки після завантаження не збігаються.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "Goalkeepeer.h"
+#include "TextFolding.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int REFRESHES = 20;
+
+    // Типовий набір фільтрів панелі, що оновлюється кілька разів на секунду.
+    const std::vector<std::string> QUERIES = {
+        "травм", "Активн", "вільний агент", "оренд", "контракт", "ВОРОТАР",
+        "гравець", "агент (активний)"
+    };
+
+    std::shared_ptr<Player> MakeStatusPlayer(int i)
+    {
+        const std::string name = "Гравець " + std::to_string(i);
+        std::shared_ptr<Player> player;
+        switch (i % 3)
+        {
+        case 0:
+            player = std::make_shared<Goalkeeper>(name, 25, "Україна", "Київ",
+                                                  1.9, 85.0, 1000000.0);
+            break;
+        case 1:
+        {
+            auto agent = std::make_shared<FreeAgent>(
+                name, 27, "Україна", "Львів", 1.8, 75.0, 500000.0,
+                Position::Midfielder, 100000.0, "Карпати");
+            if (i % 7 == 0) agent->AcceptContract("Benchmark FC");
+            player = agent;
+            break;
+        }
+        default:
+        {
+            auto contracted = std::make_shared<ContractedPlayer>(
+                name, 23, "Україна", "Одеса", 1.85, 80.0, 2000000.0,
+                Position::Forward, 300000.0, "2030-06-30");
+            if (i % 5 == 0) contracted->ListForTransfer(1500000.0, "Без умов");
+            if (i % 11 == 0)
+                contracted->SendOnLoan("Чорноморець", "2027-06-30");
+            player = contracted;
+        }
+        }
+
+        if (i % 13 == 0) player->ReportInjury("Розтягнення", 14);
+        player->SetPlayerId(FIRST_PLAYER_ID + i);
+        return player;
+    }
+
+    /**
+     * @brief Попередня реалізація FilterByStatus: GetStatus() для кожного
+     * гравця з пам'ятанням результату для кожного різного рядка статусу.
+     */
+    std::vector<std::shared_ptr<Player>> StringFilter(
+        const std::vector<std::shared_ptr<Player>>& roster,
+        const std::string& status)
+    {
+        std::vector<std::shared_ptr<Player>> filtered;
+        const std::string foldedQuery = FoldCase(status);
+        std::unordered_map<std::string, bool> matchesByStatus;
+        for (const auto& p : roster)
+        {
+            auto [it, inserted] = matchesByStatus.try_emplace(p->GetStatus());
+            if (inserted)
+                it->second = FoldCase(it->first).find(foldedQuery) !=
+                    std::string::npos;
+            if (it->second) filtered.push_back(p);
+        }
+        return filtered;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    double stringSeconds = 0.0;
+    double bitmapSeconds = 0.0;
+    double countSeconds = 0.0;
+    std::size_t matched = 0;
+    bool ok = true;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        std::vector<std::shared_ptr<Player>> roster;
+        roster.reserve(playerCount);
+        for (int i = 0; i < playerCount; ++i)
+            roster.push_back(MakeStatusPlayer(i));
+
+        ClubManager club("Benchmark FC", 0.0);
+        for (const auto& player : roster)
+            club.AddPlayer(player);
+
+        std::vector<std::vector<std::shared_ptr<Player>>> expected(QUERIES.size());
+        stringSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REFRESHES; ++r)
+                for (std::size_t q = 0; q < QUERIES.size(); ++q)
+                    expected[q] = StringFilter(roster, QUERIES[q]);
+        });
+
+        std::vector<std::vector<Player*>> actual(QUERIES.size());
+        bitmapSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REFRESHES; ++r)
+                for (std::size_t q = 0; q < QUERIES.size(); ++q)
+                    actual[q] = club.FilterByStatus(QUERIES[q]);
+        });
+
+        const std::vector<StatusFilter> listedHealthy = {
+            {PlayerStatus::Contracted | PlayerStatus::ListedForTransfer,
+             PlayerStatus::Injured}
+        };
+        countSeconds = MeasureSeconds([&]
+        {
+            for (int r = 0; r < REFRESHES; ++r)
+                matched = club.CountByStatus(listedHealthy);
+        });
+
+        for (std::size_t q = 0; q < QUERIES.size(); ++q)
+            ok = ok && std::equal(actual[q].begin(), actual[q].end(),
+                                  expected[q].begin(), expected[q].end(),
+                                  [](const Player* a, const auto& b)
+                                  {
+                                      return a == b.get();
+                                  });
+
+        std::size_t listedExpected = 0;
+        for (const auto& p : roster)
+            listedExpected += listedHealthy.front().Matches(p->GetStatusFlags());
+        ok = ok && matched == listedExpected;
+    }
+    std::cout.rdbuf(original);
+
+    const double filters = static_cast<double>(REFRESHES * QUERIES.size());
+    std::cout << "Гравців: " << playerCount << "\n"
+        << "FilterByStatus через рядки GetStatus(): "
+        << stringSeconds * 1e3 / filters << " мс/фільтр\n"
+        << "FilterByStatus через бітові площини: "
+        << bitmapSeconds * 1e3 / filters << " мс/фільтр\n"
+        << "CountByStatus (у трансфері, здорові): "
+        << countSeconds * 1e3 / REFRESHES << " мс/фільтр (" << matched
+        << " гравців)\n";
+
+    if (!ok)
+    {
+        std::cout << "[ПОМИЛКА] Результати фільтрів не збігаються з рядковим пошуком.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <sys/resource.h>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    const std::string STREAMED_FILE = "bench_stream.txt";
+    const std::string BUFFERED_FILE = "bench_stream_buffered.txt";
+
+    /** @brief Пікова резидентна пам'ять процесу, КіБ (лише зростає). */
+    long PeakMemoryKib()
+    {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    std::string ReadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int playerCount = argc > 1 ? std::stoi(argv[1]) : 1000000;
+
+    FileManager fileManager;
+    double streamedSeconds = 0.0;
+    double bufferedSeconds = 0.0;
+    long streamedGrowthKib = 0;
+    long bufferedGrowthKib = 0;
+    bool saved = false;
+    bool matches = false;
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Benchmark FC", 5000000.0);
+        for (int i = 0; i < playerCount; ++i)
+            club.AddPlayer(MakePlayer(i));
+
+        // Пік пам'яті лише зростає, тож потоковий запис вимірюється першим.
+        const long baseline = PeakMemoryKib();
+        streamedSeconds = MeasureSeconds([&]
+        {
+            saved = fileManager.SaveToFile(STREAMED_FILE, club);
+        });
+        streamedGrowthKib = PeakMemoryKib() - baseline;
+
+        // Старий шлях: увесь файл спершу збирається в пам'яті.
+        const long beforeBuffered = PeakMemoryKib();
+        bufferedSeconds = MeasureSeconds([&]
+        {
+            OutputBuffer out;
+            club.AppendTo(out);
+            std::ofstream file(fileManager.GetFullPath(BUFFERED_FILE),
+                               std::ios::binary | std::ios::trunc);
+            file.write(out.View().data(),
+                       static_cast<std::streamsize>(out.Size()));
+        });
+        bufferedGrowthKib = PeakMemoryKib() - beforeBuffered;
+
+        matches = saved && ReadFile(fileManager.GetFullPath(STREAMED_FILE)) ==
+            club.Serialize();
+    }
+    std::cout.rdbuf(original);
+
+    const auto fileBytes = saved
+        ? std::filesystem::file_size(fileManager.GetFullPath(STREAMED_FILE))
+        : 0;
+    for (const auto& file : {STREAMED_FILE, BUFFERED_FILE})
+        std::filesystem::remove(fileManager.GetFullPath(file));
+
+    std::cout << "Гравців: " << playerCount << ", розмір файлу: " << fileBytes
+        << " Б, порція: " << fileManager.GetFlushBytes() << " Б\n"
+        << "Потокове збереження: " << streamedSeconds
+        << " с, приріст пікової пам'яті " << streamedGrowthKib << " КіБ\n"
+        << "Збереження через буфер: " << bufferedSeconds
+        << " с, приріст пікової пам'яті " << bufferedGrowthKib << " КіБ\n";
+
+    if (!matches)
+    {
+        std::cout << "[ПОМИЛКА] Збережений файл не збігається з Serialize().\n";
+        return 1;
+    }
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include <vector>
 #include "User.h"
 #include "IFileHandler.h"
+#include "IRecordSource.h"
 #include "Utils.h"
 
 namespace FootballManagement
@@ -87,11 +88,18 @@ namespace FootballManagement
         bool IsLoggedIn() const;
 
         std::string Serialize() const override;
+        void AppendTo(OutputBuffer& out) const override;
+        void WriteTo(RecordSink& sink) const override;
         void Deserialize(const std::string& data) override;
 
         /**
          * @brief Спеціальний метод для завантаження повного списку користувачів мщ вектора рядків.
          */
         void DeserializeAllUsers(const std::vector<std::string>& userDatas);
+
+        /**
+         * @brief Завантажує користувачів безпосередньо з джерела записів (наприклад, MappedFile::Lines()).
+         */
+        void DeserializeAllUsers(IRecordSource& records);
     };
 }
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "ClubManager.h"
+#include "OutputBuffer.h"
+#include "RosterJournal.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Підсумок роботи автозбереження.
+     */
+    struct AutoSaveStats
+    {
+        /// @brief Проходів, що записали хоча б одну зміну.
+        std::size_t saves = 0;
+        /// @brief Записів журналу, дописаних останнім таким проходом.
+        std::size_t lastRecords = 0;
+        /// @brief Тривалість останнього проходу (забір змін, запис, ущільнення).
+        double lastSaveSeconds = 0.0;
+        /// @brief Скільки останній прохід тримав склад заблокованим.
+        double lastPauseSeconds = 0.0;
+        /// @brief Найдовше блокування складу за весь час роботи.
+        double maxPauseSeconds = 0.0;
+        bool lastSaveOk = true;
+    };
+
+    /**
+     * @brief Фонове збереження складу лише змінених гравців.
+     *
+     * Переводить ClubManager у відкладене журналювання: мутації лише
+     * позначають гравців зміненими, а окремий потік раз на інтервал (або
+     * за SaveNow) забирає набір змінених разом зі знімком складу
+     * (ClubManager::TakeChanges, O(1) під блокуванням) і дописує їхні записи
+     * в журнал уже без блокування складу. Коли журнал переповнюється, він
+     * ущільнюється в той самий знімок, з якого дописано зміни: пізніші
+     * мутації лишаються в наборі змінених до наступного проходу, а
+     * інтерфейс не чекає на диск.
+     *
+     * Записи проходу скидаються на диск одним fsync (груповий запис), тож
+     * збій живлення втрачає щонайбільше зміни за один інтервал. Зміни
+     * проходу, який не вдалося записати, повертаються до набору змінених
+     * (ClubManager::RequeueChanges) і записуються наступним проходом.
+     */
+    class AutoSaver
+    {
+    private:
+        ClubManager& club_;
+        std::shared_ptr<RosterJournal> journal_;
+        std::chrono::milliseconds interval_;
+        /// @brief Буфер записів, який перевикористовується між проходами.
+        OutputBuffer record_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable saved_;
+        bool stopping_ = false;
+        /// @brief Лічильники запитів SaveNow і проходів, що їх обслужили.
+        std::uint64_t requested_ = 0;
+        std::uint64_t completed_ = 0;
+        AutoSaveStats stats_;
+        std::thread worker_;
+
+        /** @brief Цикл фонового потоку. */
+        void Run();
+
+        /**
+         * @brief Один прохід: забирає зміни і дописує їх у журнал.
+         * Викликається лише з фонового потоку (або після його зупинки).
+         */
+        void SaveChanges();
+
+    public:
+        /// @brief Інтервал автозбереження за замовчуванням.
+        static constexpr std::chrono::milliseconds DEFAULT_INTERVAL{5000};
+
+        /**
+         * @brief Вмикає відкладене журналювання і запускає фоновий потік.
+         * @param club Менеджер клубу з підключеним журналом.
+         * @param interval Пауза між проходами.
+         * @throws std::invalid_argument якщо журнал не підключено або інтервал не додатний.
+         */
+        explicit AutoSaver(ClubManager& club,
+                           std::chrono::milliseconds interval = DEFAULT_INTERVAL);
+
+        /** @brief Викликає Stop(). */
+        ~AutoSaver();
+
+        AutoSaver(const AutoSaver&) = delete;
+        AutoSaver& operator=(const AutoSaver&) = delete;
+
+        /**
+         * @brief Запитує позачерговий прохід і чекає на його завершення.
+         * Після зупинки зберігає зміни в потоці, що викликав.
+         */
+        void SaveNow();
+
+        /**
+         * @brief Зупиняє потік, зберігає залишок змін і повертає менеджер
+         * до негайного журналювання. Викликається з потоку, що змінює склад
+         * (або коли зміни вже припинено). Повторний виклик нічого не робить.
+         */
+        void Stop();
+
+        [[nodiscard]] AutoSaveStats GetStats() const;
+
+        /** @brief Кількість гравців, ще не збережених у журнал. */
+        [[nodiscard]] std::size_t GetDirtyCount() const;
+    };
+}
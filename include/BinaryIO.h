@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace FootballManagement
+{
+    /// @brief Сигнатура бінарного знімка складу.
+    constexpr std::string_view BINARY_SNAPSHOT_MAGIC = "FMSB";
+
+    /// @brief Поточна версія бінарного формату (2 — заголовок клубу містить наступний ID).
+    constexpr std::uint32_t BINARY_SNAPSHOT_VERSION = 2;
+
+    /**
+     * @brief Запис бінарного знімка: числа фіксованої ширини (little-endian),
+     * рядки — індекси у спільній таблиці рядків.
+     *
+     * Структура файлу: сигнатура, версія, таблиця рядків, тіло.
+     * Тіло формує викликач; записи в ньому обрамлюються BeginRecord/EndRecord
+     * (тег + довжина), щоб читач міг пропускати невідомі типи.
+     */
+    class BinaryWriter
+    {
+    private:
+        std::string body_;
+        std::unordered_map<std::string, std::uint32_t> stringIndex_;
+        std::vector<const std::string*> strings_;
+
+        template <typename T>
+        void WriteLittleEndian(T value);
+
+    public:
+        BinaryWriter() = default;
+
+        void WriteU8(std::uint8_t value);
+        void WriteU32(std::uint32_t value);
+        void WriteI32(std::int32_t value);
+        void WriteU64(std::uint64_t value);
+        void WriteF64(double value);
+        void WriteBool(bool value);
+
+        /**
+         * @brief Записує індекс рядка у таблиці (рядок додається один раз).
+         */
+        void WriteString(const std::string& value);
+
+        /**
+         * @brief Починає запис: тег типу та місце під довжину.
+         * @param tag Тег типу запису.
+         * @return Позиція, яку потрібно передати у EndRecord.
+         */
+        std::size_t BeginRecord(std::uint8_t tag);
+
+        /**
+         * @brief Завершує запис, дописуючи його довжину.
+         * @param mark Значення, повернуте BeginRecord.
+         */
+        void EndRecord(std::size_t mark);
+
+        /**
+         * @brief Формує повний вміст файлу (заголовок + таблиця рядків + тіло).
+         */
+        [[nodiscard]] std::string Finish() const;
+    };
+
+    /**
+     * @brief Читання бінарного знімка, створеного BinaryWriter.
+     * Рядки повертаються як види на вхідний буфер (без копіювання).
+     */
+    class BinaryReader
+    {
+    private:
+        std::string_view data_;
+        std::size_t pos_;
+        std::uint32_t version_;
+        std::vector<std::string_view> strings_;
+
+        void Require(std::size_t bytes) const;
+
+        template <typename T>
+        T ReadLittleEndian();
+
+    public:
+        /**
+         * @brief Перевіряє сигнатуру й версію (1..BINARY_SNAPSHOT_VERSION) та зчитує таблицю рядків.
+         * @param data Повний вміст файлу.
+         * @throws std::runtime_error якщо дані пошкоджені чи версія не підтримується.
+         */
+        explicit BinaryReader(std::string_view data);
+
+        /**
+         * @brief Чи починаються дані з сигнатури бінарного знімка.
+         */
+        static bool HasMagic(std::string_view data);
+
+        /** @brief Версія формату, якою записано знімок. */
+        std::uint32_t Version() const;
+
+        std::uint8_t ReadU8();
+        std::uint32_t ReadU32();
+        std::int32_t ReadI32();
+        std::uint64_t ReadU64();
+        double ReadF64();
+        bool ReadBool();
+        std::string_view ReadString();
+
+        /** @brief Поточна позиція у буфері. */
+        [[nodiscard]] std::size_t Position() const;
+
+        /**
+         * @brief Переходить до вказаної позиції (наприклад, кінця запису).
+         * @throws std::runtime_error якщо позиція за межами буфера.
+         */
+        void Seek(std::size_t position);
+    };
+}
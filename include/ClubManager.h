@@ -1,32 +1,293 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 #include "Player.h"
 #include "FreeAgent.h"
 #include "ContractedPlayer.h"
-#include "IFileHandler.h"
+#include "ISnapshotHandler.h"
+#include "IRecordSource.h"
+#include "NameIndex.h"
+#include "NumericIndex.h"
+#include "PersistentVector.h"
+#include "RankingView.h"
+#include "RosterColumns.h"
+#include "RosterQuery.h"
+#include "RosterSnapshot.h"
+#include "StatusBitmap.h"
+#include "ThreadPool.h"
 #include "Utils.h"
 
 namespace FootballManagement
 {
+    class RosterJournal;
+
+    /**
+     * @brief Пропускна здатність одного робочого потоку масової операції.
+     */
+    struct WorkerThroughput
+    {
+        std::size_t firstSlot = 0;
+        std::size_t scanned = 0;
+        std::size_t updated = 0;
+        double seconds = 0.0;
+
+        /** @brief Переглянуто гравців за секунду. */
+        [[nodiscard]] double PlayersPerSecond() const;
+    };
+
+    /**
+     * @brief Підсумок ApplyMarketAdjustment.
+     */
+    struct MarketAdjustmentReport
+    {
+        std::size_t updated = 0;
+        double seconds = 0.0;
+        double indexSeconds = 0.0;
+        /// @brief По одному запису на частину складу, у порядку слотів.
+        std::vector<WorkerThroughput> workers;
+    };
+
+    /**
+     * @brief Зміни складу, накопичені у відкладеному режимі журналювання.
+     */
+    struct RosterChanges
+    {
+        /// @brief Склад на момент, коли зміни забрано; містить їх усі.
+        RosterSnapshot snapshot;
+        /// @brief ID доданих, змінених або видалених гравців (за зростанням).
+        std::vector<int> playerIds;
+        bool budgetChanged = false;
+        /// @brief Скільки забір змін тримав виняткове блокування складу.
+        double lockSeconds = 0.0;
+    };
+
     /**
      * @brief Клас-менеджер для управління колекцією об'єктів Player.
+     *
+     * Склад володіє гравцями через std::shared_ptr; результати пошуку,
+     * фільтрів і рейтингів — невласницькі покажчики Player*, дійсні до
+     * наступної мутації складу. Так результати не змінюють атомарні
+     * лічильники посилань. Мутація гравця, якого може бачити живий знімок,
+     * замінює об'єкт у складі копією (див. WritablePlayer): старий Player*
+     * чи shared_ptr з FindById лишається дійсним, але показує стан до зміни.
+     * Тому між мутаціями гравця тримають за ID і знаходять наново, а
+     * змінюють через ModifyPlayer, а не через об'єкт з результатів.
+     *
+     * Методи потокобезпечні: запити виконуються паралельно під спільним
+     * блокуванням, мутації складу — під винятковим. Покажчики Player*
+     * з результатів не захищені від одночасного RemovePlayers; потоки, що
+     * працюють поряд із писачем, мають тримати гравця через FindById або
+     * обробляти результати у VisitQuery. Columns() і прямі зміни об'єктів
+     * гравців не синхронізуються.
+     *
+     * Довгі звіти працюють зі знімком Snapshot(): він знімається за O(1)
+     * і не блокує подальших змін складу.
      */
-    class ClubManager : public IFileHandler
+    class ClubManager : public ISnapshotHandler
     {
     private:
         std::vector<std::shared_ptr<Player> > players_;
+        std::unordered_map<int, std::size_t> slotById_;
+        NameIndex nameIndex_;
+        StatusBitmap statuses_;
+        NumericIndex valueIndex_;
+        NumericIndex ageIndex_;
+        NumericIndex salaryIndex_;
+        RosterColumns columns_;
+        std::atomic<int> nextId_;
         double transferBudget_;
         std::string clubName_;
+        std::shared_ptr<RosterJournal> journal_;
+        /// @brief Буфер записів журналу, який перевикористовується між мутаціями.
+        OutputBuffer journalBuffer_;
+        /// @brief Мутації лише позначають гравців зміненими (див. TakeChanges).
+        bool deferJournal_ = false;
+        std::unordered_set<int> dirtyIds_;
+        bool budgetDirty_ = false;
+        mutable std::optional<RankingView> ranking_;
+        /// @brief Дзеркало players_ зі спільною структурою, з якого знімаються знімки.
+        PersistentVector<std::shared_ptr<const Player>> published_;
+        /// @brief Значення snapshotCount_ на момент, коли об'єкт гравця потрапив у слот.
+        std::vector<std::uint64_t> placedAt_;
+        mutable std::atomic<std::uint64_t> snapshotCount_{0};
+        /// @brief Кількість живих знімків (спільна з їхніми «орендами»).
+        std::shared_ptr<std::atomic<std::size_t>> liveSnapshots_;
+        mutable std::shared_mutex mutex_;
+        /// @brief Потік, що тримає виняткове блокування (інакше — порожній ID).
+        std::atomic<std::thread::id> writer_;
+        /// @brief Захищає ranking_ від одночасних читачів (він досортовується ліниво).
+        mutable std::mutex rankingMutex_;
 
         /**
-       * @brief Генерує унікальний ID для нового гравця.
-       * @return Новий унікальний ID.
-       */
-        int GenerateUniqueId() const;
+         * @brief Виняткове блокування складу.
+         * Якщо потік уже є писачем (мутація викликала іншу мутацію чи
+         * ущільнення журналу), повторно нічого не блокується.
+         */
+        class ExclusiveLock
+        {
+        private:
+            ClubManager* owner_ = nullptr;
+
+        public:
+            explicit ExclusiveLock(ClubManager& manager);
+            ~ExclusiveLock() noexcept;
+
+            ExclusiveLock(const ExclusiveLock&) = delete;
+            ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+        };
+
+        /**
+         * @brief Спільне блокування для запитів; для потоку-писача — порожнє,
+         * бо він уже має винятковий доступ.
+         */
+        [[nodiscard]] std::shared_lock<std::shared_mutex> LockShared() const;
+
+        /**
+         * @brief Піднімає верхню межу послідовності ID так, щоб наступний ID був більшим за playerId.
+         * @param playerId ID, який уже використовується.
+         */
+        void ObserveId(int playerId);
+
+        /**
+         * @brief Повертає позицію гравця у players_ за O(1) через індекс slotById_.
+         * @param playerId ID гравця.
+         * @return Індекс або players_.size(), якщо гравця немає.
+         */
+        std::size_t FindSlot(int playerId) const;
+
+        /**
+         * @brief Додає гравця в кінець players_ і в індекс.
+         * @return bool False, якщо гравець із таким ID уже є (склад не змінюється).
+         */
+        bool AppendPlayer(std::shared_ptr<Player> player);
+
+        /**
+         * @brief Те саме, що AppendPlayer, але без іменного індексу
+         * (для завантажувачів, що будують його окремо).
+         */
+        bool AppendUnnamed(std::shared_ptr<Player> player);
+
+        /**
+         * @brief Видаляє гравця зі слота і виправляє індекс.
+         * Порядок складу зберігається: наступні слоти зсуваються на один,
+         * тож видалення — O(n), а пошук за ID лишається O(1).
+         */
+        void EraseSlot(std::size_t slot);
+
+        /**
+         * @brief Очищує склад разом з індексом, скидає послідовність ID
+         * і резервує місце під capacity гравців — і в контейнерах, і в
+         * аренах PlayerFactory.
+         */
+        void ResetRoster(std::size_t capacity);
+
+        /// @brief Позначка конструктора тимчасового складу для завантаження.
+        struct StagingTag
+        {
+        };
+
+        /**
+         * @brief Тимчасовий склад, у який читається знімок (без повідомлення
+         * про створення менеджера).
+         */
+        ClubManager(StagingTag, const std::string& name, double budget);
+
+        /**
+         * @brief Замінює склад повністю завантаженим тимчасовим складом.
+         * Викликається під винятковим блокуванням; журнал, знімки та режим
+         * журналювання лишаються, незбережені зміни відкидаються.
+         */
+        void AdoptRoster(ClubManager&& staged);
+
+        /** @brief Тіло DeserializeAllPlayers для тимчасового складу. */
+        void LoadRecords(IRecordSource& records);
+
+        /** @brief Тіло DeserializeAllPlayersParallel для тимчасового складу. */
+        void LoadTextParallel(std::string_view data, ThreadPool& pool);
+
+        /** @brief Тіло DeserializeBinary для тимчасового складу. */
+        void LoadBinary(std::string_view data);
+
+        /**
+         * @brief Розбирає заголовок "назва,бюджет[,наступний ID]" знімка.
+         * Помилки розбору виводяться в консоль; склад не змінюється.
+         */
+        void ApplyHeader(std::string_view header);
+
+        /**
+         * @brief Виводить підсумок завантаження складу.
+         */
+        void ReportLoad(std::size_t total, std::size_t skipped,
+                        double seconds) const;
+
+        /**
+         * @brief Оновлює вторинні індекси гравця (вартість, вік, зарплата).
+         * Зарплату мають лише гравці з контрактом; інших з індексу зарплат видалено.
+         */
+        void IndexNumericFields(const Player& player);
+
+        /**
+         * @brief Оновлює всі індекси гравця в слоті після зміни його стану
+         * (ім'я, статус, числові поля, рядок стовпців, опублікована версія)
+         * і скидає кешований рейтинг.
+         */
+        void ReindexPlayer(std::size_t slot);
+
+        /**
+         * @brief Перебудовує індекс, бітові площини статусів і стовпці
+         * після зміни порядку players_.
+         */
+        void RebuildIndex();
+
+        /**
+         * @brief Гравець у слоті з правом запису. Якщо об'єкт може бачити
+         * живий знімок, слот спершу отримує копію (Player::Clone), а знімок
+         * зберігає оригінал. Публікація копії — через ReindexPlayer.
+         */
+        Player& WritablePlayer(std::size_t slot);
+
+        /** @brief Скидає кешований рейтинг після зміни складу чи гравця. */
+        void InvalidateRanking();
+
+        /**
+         * @brief Повертає кешований рейтинг, будуючи його за потреби.
+         * Читачі викликають його й користуються рейтингом під rankingMutex_.
+         */
+        RankingView& Ranking() const;
+
+        /**
+         * @brief Записує мутацію в журнал (якщо він підключений) і ущільнює його за потреби.
+         */
+        void JournalChange(std::string_view op, std::string_view payload);
+
+        /**
+         * @brief Журналює запис гравця, серіалізуючи його у journalBuffer_
+         * (лише якщо журнал підключений).
+         */
+        void JournalPlayer(std::string_view op, const Player& player);
+
+        /** @brief Журналює видалення гравця (або позначає його зміненим). */
+        void JournalRemoval(int playerId);
+
+        /** @brief Журналює поточний бюджет (або позначає його зміненим). */
+        void JournalBudget();
+
+        /**
+         * @brief Застосовує один запис журналу до складу без повторного журналювання.
+         * @return bool False, якщо запис пошкоджений або невідомий.
+         */
+        bool ApplyJournalEntry(std::string_view entry);
 
     public:
         /**
@@ -47,43 +308,248 @@ namespace FootballManagement
         /**
          * @brief Додає нового гравця до колекції та присвоює ID.
          * @param p Вказівник на об'єкт Player.
+         * @throws std::invalid_argument якщо гравець порожній або його ID уже зайнятий.
          */
         void AddPlayer(std::shared_ptr<Player> p);
 
+        /**
+         * @brief Знаходить гравця за ID за O(1).
+         * Повертає поточний об'єкт слота; після мутації гравця його треба
+         * знайти наново (див. опис класу).
+         * @param playerId ID гравця.
+         * @return std::shared_ptr<Player> Гравець або nullptr, якщо його немає.
+         */
+        std::shared_ptr<Player> FindById(int playerId) const;
+
+        /**
+         * @brief Видає наступний ID із послідовності (потокобезпечно, за O(1)).
+         * @return Новий унікальний ID.
+         */
+        int AllocateId();
+
+        /**
+         * @brief Резервує блок із count послідовних ID за одну атомарну операцію.
+         * @param count Кількість ID.
+         * @return Перший ID блоку; блок займає [first, first + count).
+         * @throws std::invalid_argument якщо count не додатний.
+         */
+        int AllocateIds(int count);
+
+        /** @brief ID, який буде видано наступним (верхня межа послідовності). */
+        int GetNextId() const;
+
+        /** @brief Кількість гравців у складі. */
+        std::size_t GetPlayerCount() const;
+
         /**
          * @brief Виводить повний список усіх гравців у консоль.
+         * Друкує знімок складу, тож не блокує зміни на час виводу.
          */
         void ViewAllPlayers() const;
 
+        /**
+         * @brief Незмінна версія складу за O(1) для довгих звітів.
+         * Зміни через методи менеджера після знімка його не зачіпають:
+         * змінюваний гравець спершу копіюється. Зміни об'єктів гравців в обхід
+         * менеджера (через FindById) знімок побачить — для них є ModifyPlayer.
+         */
+        RosterSnapshot Snapshot() const;
+
         /**
          * @brief Видаляє гравця за його ID.
+         * Порядок решти гравців (перегляд, збереження, знімки) зберігається,
+         * тож видалення займає O(n).
          * @param playerId ID гравця для видалення.
          */
         void RemovePlayers(int playerId);
 
         /**
-         * @brief Сортує гравців за показником ефективності.
+         * @brief Фізично впорядковує склад за показником ефективності.
+         * Рейтинги беруться з кешованого RankingView (по одному обчисленню на гравця).
          */
         void SortByPerformanceRating();
 
         /**
-         * @brief Шукає гравців за частиною імені.
+         * @brief Повертає k найкращих гравців за рейтингом, не змінюючи склад.
+         * Рейтинг кешується до наступної зміни складу або RecordPlayerUpdate.
+         * @param k Кількість гравців.
+         * @return std::vector<Player*> Гравці у порядку рейтингу.
+         */
+        std::vector<Player*> TopPerformers(std::size_t k) const;
+
+        /**
+         * @brief Виводить рейтинг гравців у консоль.
+         * @param limit Кількість позицій (0 — усі).
+         */
+        void ViewRanking(std::size_t limit = 0) const;
+
+        /**
+         * @brief Шукає гравців за частиною імені (без урахування регістру)
+         * через індекс триграм NameIndex.
          * @param nameQuery Частина імені для пошуку.
-         * @return std::vector<std::shared_ptr<Player>> Знайдені гравці.
+         * @param limit Максимальна кількість результатів (0 — без обмеження).
+         * @return std::vector<Player*> Знайдені гравці.
          */
-        std::vector<std::shared_ptr<Player>> SearchByName(
-            const std::string& q) const;
+        std::vector<Player*> SearchByName(
+            const std::string& nameQuery, std::size_t limit = 0) const;
 
         /**
-         * @brief Фільтрує гравців за статусом.
+         * @brief Фільтрує гравців за статусом (частина назви статусу,
+         * без урахування регістру, зокрема для кирилиці).
+         * Запит зіставляється з назвами статусів один раз, далі фільтр
+         * виконується над бітовими площинами статусів.
          * @param status Статус для фільтрації.
-         * @return std::vector<std::shared_ptr<Player>> Відфільтровані гравці.
+         * @return std::vector<Player*> Відфільтровані гравці.
          */
-        std::vector<std::shared_ptr<Player>> FilterByStatus(
+        std::vector<Player*> FilterByStatus(
             const std::string& status) const;
 
+        /**
+         * @brief Фільтрує гравців за прапорцями статусу.
+         * @param required Прапорці, які мають бути встановлені всі.
+         * @param excluded Прапорці, жоден з яких не має бути встановлений.
+         * @return std::vector<Player*> Відфільтровані гравці.
+         */
+        std::vector<Player*> FilterByStatus(
+            PlayerStatus required,
+            PlayerStatus excluded = PlayerStatus::None) const;
+
+        /**
+         * @brief Фільтрує гравців за кількома умовами, об'єднаними через АБО.
+         * @param anyOf Умови фільтра.
+         * @return std::vector<Player*> Відфільтровані гравці.
+         */
+        std::vector<Player*> FilterByStatus(
+            const std::vector<StatusFilter>& anyOf) const;
+
+        /**
+         * @brief Кількість гравців, що задовольняють хоча б одну умову (без вибірки гравців).
+         * @param anyOf Умови фільтра.
+         */
+        std::size_t CountByStatus(const std::vector<StatusFilter>& anyOf) const;
+
+        /**
+         * @brief ID гравців із ринковою вартістю в [minValue, maxValue] за O(log n + k).
+         * @return std::vector<int> ID за зростанням вартості.
+         */
+        std::vector<int> FindByMarketValue(double minValue, double maxValue) const;
+
+        /**
+         * @brief ID гравців віком у [minAge, maxAge] за O(log n + k).
+         * @return std::vector<int> ID за зростанням віку.
+         */
+        std::vector<int> FindByAge(int minAge, int maxAge) const;
+
+        /**
+         * @brief ID гравців із контрактом і зарплатою в [minSalary, maxSalary] за O(log n + k).
+         * @return std::vector<int> ID за зростанням зарплати.
+         */
+        std::vector<int> FindBySalary(double minSalary, double maxSalary) const;
+
+        /**
+         * @brief Змінює ринкову вартість гравця на відсоток, оновлюючи індекси та журнал.
+         * @param playerId ID гравця.
+         * @param percentageChange Відсоток зміни (наприклад, 10.0 => +10%).
+         * @return bool False, якщо гравця з таким ID немає.
+         */
+        bool UpdatePlayerMarketValue(int playerId, double percentageChange);
+
+        /**
+         * @brief Святкує день народження гравця (вік +1 і пов'язані зміни),
+         * оновлюючи індекси та журнал.
+         * @param playerId ID гравця.
+         * @return bool False, якщо гравця з таким ID немає.
+         */
+        bool CelebratePlayerBirthday(int playerId);
+
+        /**
+         * @brief Змінює зарплату гравця з контрактом на відсоток, оновлюючи індекси та журнал.
+         * @param playerId ID гравця.
+         * @param percentageChange Відсоток зміни.
+         * @return bool False, якщо гравця немає або він без контракту.
+         */
+        bool AdjustPlayerSalary(int playerId, double percentageChange);
+
+        /**
+         * @brief Змінює ринкову вартість усіх гравців, що задовольняють умову.
+         *
+         * Склад ділиться на суцільні частини слотів, по одній на потік пулу;
+         * кожен гравець оновлюється рівно одним потоком, тож результат не
+         * залежить від планування потоків. Індекс вартостей оновлюється
+         * одним пакетом після завершення всіх частин, журнал отримує записи
+         * у порядку слотів.
+         * @param predicate Умова; викликається паралельно і має читати лише свій аргумент
+         * (не звертатися до ClubManager).
+         * @param percentageChange Відсоток зміни (наприклад, 10.0 => +10%).
+         * @param pool Пул потоків (за замовчуванням — ThreadPool::Shared()).
+         * @return MarketAdjustmentReport Кількість змінених гравців і пропускна здатність потоків.
+         */
+        MarketAdjustmentReport ApplyMarketAdjustment(
+            const std::function<bool(const Player&)>& predicate,
+            double percentageChange, ThreadPool& pool = ThreadPool::Shared());
+
+        /**
+         * @brief Стовпцеве дзеркало числових полів складу, індексоване слотом гравця.
+         * Стовпці синхронні з гравцями, доки зміни проходять через ClubManager
+         * (для мутацій поза ним — після RecordPlayerUpdate). Посилання не
+         * захищене блокуванням: читати стовпці можна, лише коли склад не змінюється.
+         */
+        const RosterColumns& Columns() const;
+
+        /**
+         * @brief Кількість, сума, середнє, мінімум і максимум стовпця по всьому складу.
+         * @param column Стовпець (наприклад, RosterColumn::Goals).
+         */
+        ColumnSummary SummarizeColumn(RosterColumn column) const;
+
+        /**
+         * @brief Розрахункова вартість (CalculateValue) кожного гравця
+         * у порядку Columns().PlayerIds().
+         * Рейтинги воротарів і вартості вбудованих типів рахуються
+         * векторними ядрами RatingKernels над стовпцями; результат побітово
+         * збігається з CalculateValue(). Для типів поза ядром — віртуальний виклик.
+         */
+        std::vector<double> RevaluateRoster() const;
+
+        /**
+         * @brief Сумарна розрахункова вартість складу (сума RevaluateRoster()).
+         */
+        double CalculateSquadValue() const;
+
+        /**
+         * @brief k гравців із найбільшими (або найменшими) значеннями стовпця.
+         * @param column Стовпець.
+         * @param k Кількість гравців.
+         * @param descending True — найбільші значення першими.
+         * @return std::vector<Player*> Гравці у порядку значення (при рівності — за ID).
+         */
+        std::vector<Player*> TopByColumn(
+            RosterColumn column, std::size_t k, bool descending = true) const;
+
+        /**
+         * @brief Починає компонований запит до складу (див. RosterQuery).
+         * @return RosterQuery Порожній запит, що повертає всіх гравців.
+         */
+        RosterQuery Query() const;
+
+        /**
+         * @brief Виконує умови запиту одним проходом і викликає visit для кожного результату.
+         * Кандидати беруться з індексу імен, діапазону вторинного індексу
+         * (вартість, вік, зарплата), бітових площин статусу або (для рейтингу
+         * за спаданням) з кешованого RankingView. Сортування за вартістю чи
+         * віком з обмеженням читає відповідний індекс уже впорядкованим;
+         * без сортування результати йдуть у порядку джерела кандидатів.
+         * @param criteria Умови запиту.
+         * @param visit Повертає false, щоб зупинити обхід. Викликається під
+         * спільним блокуванням, тож не повинен змінювати склад.
+         */
+        void VisitQuery(const QueryCriteria& criteria,
+                        const std::function<bool(const Player&)>& visit) const;
+
         /**
          * @brief Реалізує логіку підписання вільного агента та перетворює його на ContractedPlayer.
+         * Агента зі складу знаходить за ID і змінює через WritablePlayer, тож
+         * переданий об'єкт після виклику може бути застарілою копією.
          * @param player Вільний агент для підписання.
          * @param salaryOffer Запропонована зарплата.
          * @param contractUntil Термін дії контракту.
@@ -93,13 +559,143 @@ namespace FootballManagement
                            double salaryOffer,
                            const std::string& contractUntil);
 
+        /**
+         * @brief Перейменовує гравця, оновлюючи індекс пошуку та журнал.
+         * @param playerId ID гравця.
+         * @param newName Нове ім'я.
+         * @return bool False, якщо гравця з таким ID немає.
+         */
+        bool RenamePlayer(int playerId, const std::string& newName);
+
+        /**
+         * @brief Змінює гравця під винятковим блокуванням, не зачіпаючи знімків,
+         * і фіксує зміну в індексах та журналі.
+         * @param playerId ID гравця.
+         * @param change Зміна; не повинна змінювати ID гравця.
+         * @return bool False, якщо гравця з таким ID немає.
+         */
+        bool ModifyPlayer(int playerId, const std::function<void(Player&)>& change);
+
+        /**
+         * @brief Фіксує зміну стану гравця (статистика, травма тощо) у журналі.
+         * Викликається після мутації об'єкта гравця поза ClubManager; також
+         * оновлює індекс імен, рейтинг і прапорці статусу гравця. Така мутація
+         * видна живим знімкам, тож поряд з автозбереженням — лише ModifyPlayer.
+         * @param playerId ID зміненого гравця.
+         */
+        void RecordPlayerUpdate(int playerId);
+
+        /**
+         * @brief Підключає журнал змін; надалі мутації складу зберігаються за O(зміни).
+         * @param journal Журнал (nullptr — відключити).
+         */
+        void AttachJournal(std::shared_ptr<RosterJournal> journal);
+
+        /** @brief Повертає підключений журнал (або nullptr). */
+        std::shared_ptr<RosterJournal> GetJournal() const;
+
+        /**
+         * @brief Вмикає або вимикає відкладене журналювання.
+         * У відкладеному режимі мутації не пишуть у журнал, а лише додають
+         * ID гравця до набору змінених; записи в журнал дописує той, хто
+         * забирає зміни через TakeChanges (AutoSaver). Перед вимкненням
+         * накопичені зміни потрібно забрати, інакше вони не потраплять у журнал.
+         */
+        void SetDeferredJournaling(bool deferred);
+
+        /**
+         * @brief Забирає накопичені зміни разом зі знімком, у якому вони вже є.
+         * Під винятковим блокуванням лише обмінюється набір змінених і
+         * знімається знімок (обидва O(1)), тож мутації не чекають на запис.
+         */
+        RosterChanges TakeChanges();
+
+        /**
+         * @brief Повертає забрані зміни до набору змінених, якщо їх не вдалося
+         * записати в журнал: наступний TakeChanges віддасть їх знову.
+         * @param playerIds ID гравців із RosterChanges::playerIds.
+         * @param budgetChanged RosterChanges::budgetChanged.
+         */
+        void RequeueChanges(const std::vector<int>& playerIds, bool budgetChanged);
+
+        /** @brief Кількість гравців, змінених з останнього TakeChanges. */
+        std::size_t GetDirtyCount() const;
+
+        /**
+         * @brief Програє записи журналу поверх поточного складу.
+         * Пошкоджені (обірвані) записи пропускаються.
+         * @param entries Джерело рядків журналу.
+         * @return Кількість застосованих записів.
+         */
+        std::size_t ReplayJournal(IRecordSource& entries);
+
         std::string Serialize() const override;
+
+        /**
+         * @brief Дописує заголовок клубу і по рядку на гравця в один буфер.
+         */
+        void AppendTo(OutputBuffer& out) const override;
+
+        /**
+         * @brief Потоково пише той самий вміст, що й AppendTo, запис за записом.
+         * Дані беруться зі знімка Snapshot(), тож тривалий запис на диск
+         * не блокує зміни складу.
+         */
+        void WriteTo(RecordSink& sink) const override;
+
         void Deserialize(const std::string& data) override;
 
+        /**
+         * @brief Бінарний знімок складу; як і WriteTo, пише зі Snapshot(),
+         * тож зміни складу не чекають на серіалізацію.
+         */
+        std::string SerializeBinary() const override;
+
+        /**
+         * @brief Завантажує бінарний знімок; склад замінюється лише після
+         * успішного розбору всього файлу.
+         * @throws std::runtime_error якщо знімок пошкоджений (склад не змінено).
+         */
+        void DeserializeBinary(std::string_view data) override;
+        void DeserializeRecords(IRecordSource& records) override;
+
+        /** @brief Завантажує текстовий знімок через DeserializeAllPlayersParallel. */
+        void DeserializeText(std::string_view data) override;
+
         /**
          * @brief Спеціальний метод для завантаження даних із вектора рядків, отриманих з FileManager.
+         * Перший рядок — заголовок клубу "назва,бюджет[,наступний ID]", далі по одному
+         * запису з тегом "type" на гравця;
+         * гравці створюються через PlayerFactory.
          * @param lines Вектор рядків, прочитаних із файлу.
          */
         void DeserializeAllPlayers(const std::vector<std::string>& lines);
+
+        /**
+         * @brief Завантажує клуб і гравців безпосередньо з джерела записів
+         * (наприклад, MappedFile::Lines()) без копіювання рядків.
+         * Окремі пошкоджені записи пропускаються; склад замінюється лише
+         * після того, як джерело прочитано до кінця.
+         * @param records Джерело записів; перший запис — заголовок клубу.
+         * @throws std::runtime_error якщо читання зупинено (склад не змінено).
+         */
+        void DeserializeAllPlayers(IRecordSource& records);
+
+        /**
+         * @brief Завантажує клуб і гравців із повного тексту знімка, розбираючи записи паралельно.
+         *
+         * Текст після заголовка ділиться на фрагменти, вирівняні по '\n';
+         * фрагментів у кілька разів більше, ніж потоків, тож вільні потоки
+         * забирають наступні фрагменти зі спільної черги, поки інші
+         * розбирають довгі. Розбір іде без блокування менеджера; потім
+         * гравці додаються у склад в порядку файлу, а повторні ID
+         * пропускаються з тими самими повідомленнями, що й у послідовному
+         * завантаженні.
+         * @param data Вміст файлу (наприклад, MappedFile::Data()); перший рядок — заголовок клубу.
+         * @param pool Пул потоків для розбору.
+         * @throws Перший виняток задачі розбору (склад не змінено).
+         */
+        void DeserializeAllPlayersParallel(std::string_view data,
+                                           ThreadPool& pool = ThreadPool::Shared());
     };
 }
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include "OutputBuffer.h"
 
 namespace FootballManagement
 {
+    class BinaryWriter;
+    class BinaryReader;
+
     /**
      * @brief Клас, що інкапсулює всі деталі контракту гравця.
      * Використовується для композиції у класах, що керують гравцями.
@@ -94,5 +100,30 @@ namespace FootballManagement
          * @brief Виводить стислу інформацію про контракт.
          */
         void ShowDetails() const;
+
+        /**
+         * @brief Серіалізує поля контракту як пари "key":value.
+         * @return Фрагмент запису без обрамлюючих дужок.
+         */
+        std::string Serialize() const;
+
+        /**
+         * @brief Дописує поля контракту у буфер (те саме, що й Serialize).
+         */
+        void AppendTo(OutputBuffer& out) const;
+
+        /**
+         * @brief Застосовує одне поле запису до контракту.
+         * @param keyHash Хеш ключа (HashKey).
+         * @param value Значення без лапок.
+         * @return bool True, якщо ключ належить контракту.
+         */
+        bool DeserializeField(std::uint64_t keyHash, std::string_view value);
+
+        /** @brief Записує поля контракту у бінарному форматі. */
+        void WriteBinary(BinaryWriter& writer) const;
+
+        /** @brief Зчитує поля контракту з бінарного формату. */
+        void ReadBinary(BinaryReader& reader);
     };
 }
@@ -2,6 +2,7 @@
 
 #include "FieldPlayer.h"
 #include "ContractDetails.h"
+#include <span>
 #include <string>
 
 namespace FootballManagement
@@ -19,14 +20,15 @@ namespace FootballManagement
         double transferFee_;
         std::string transferConditions_;
 
+        /** @brief Формула рейтингу без віртуального виклику (для пакетних обчислень). */
+        [[nodiscard]] double RatingFormula() const;
+
+        /** @brief Формула вартості для вже обчисленого рейтингу. */
+        [[nodiscard]] double ValueFormula(double rating) const;
+
     public:
         /** @brief Конструктор за замовчуванням. */
         ContractedPlayer();
-        ContractedPlayer(const std::string& name, int age,
-                         const std::string& nationality, std::string& origin,
-                         double height, double weight, double marketValue,
-                         Position position, double salary,
-                         const std::string& contractUntil);
 
         /**
          * @brief Конструктор із параметрами для ініціалізації контрактного гравця.
@@ -67,6 +69,15 @@ namespace FootballManagement
         [[nodiscard]] double GetTransferFee() const;
         [[nodiscard]] ContractDetails GetContractDetails() const;
 
+        /** @brief Поточна річна зарплата за контрактом (без копіювання ContractDetails). */
+        [[nodiscard]] double GetSalary() const;
+
+        /**
+         * @brief Змінює зарплату за контрактом на відсоток.
+         * @param percentageChange Відсоток зміни (наприклад, 10.0 => +10%).
+         */
+        void AdjustSalary(double percentageChange);
+
         /**
          * @brief Виставляє гравця на трансфер з вказаною ціною та умовами.
          * @param fee Мінімальна ціна продажу.
@@ -110,10 +121,34 @@ namespace FootballManagement
 
         [[nodiscard]] double CalculateValue() const override;
         [[nodiscard]] std::string GetStatus() const override;
+        [[nodiscard]] PlayerStatus GetStatusFlags() const override;
         void ShowInfo() const override;
-        void CelebrateBirthday() override = 0;
-        [[nodiscard]] double CalculatePerformanceRating() const override = 0;
-        [[nodiscard]] std::string Serialize() const override = 0;
-        void Deserialize(const std::string& data) override = 0;
+        void CelebrateBirthday() override;
+        [[nodiscard]] double CalculatePerformanceRating() const override;
+        void AppendTo(OutputBuffer& out) const override;
+        void Deserialize(const std::string& data) override;
+
+        [[nodiscard]] PlayerRecordTag GetRecordTag() const override;
+        [[nodiscard]] std::shared_ptr<Player> Clone() const override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        void ReadBinary(BinaryReader& reader) override;
+        void WriteColumns(RosterRow& row) const override;
+
+        /**
+         * @brief Рейтинги пакета гравців із контрактом без віртуальних викликів.
+         * Динамічний тип кожного елемента — саме ContractedPlayer (див. PlayerBatches).
+         * @param players Пакет гравців.
+         * @param out Результати у тому ж порядку (розмір як у players).
+         */
+        static void RateBatch(std::span<const ContractedPlayer* const> players,
+                              std::span<double> out);
+
+        /** @brief Ринкова вартість (CalculateValue) пакета гравців із контрактом; умови як у RateBatch. */
+        static void ValueBatch(std::span<const ContractedPlayer* const> players,
+                               std::span<double> out);
+
+    protected:
+        bool DeserializeField(std::uint64_t keyHash,
+                              std::string_view value) override;
     };
 }
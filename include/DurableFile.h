@@ -0,0 +1,80 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Файл для запису з явним скиданням на носій (RAII).
+     *
+     * Записане через Write() потрапляє в кеш ОС одразу, але переживає збій
+     * живлення лише після Sync() (fsync). Деструктор закриває файл без Sync.
+     * На платформах без POSIX пише через std::ofstream, а Sync() лише
+     * скидає буфер потоку.
+     */
+    class DurableFile
+    {
+    private:
+        int fd_;
+        std::ofstream fallback_;
+
+    public:
+        /** @brief Режим відкриття: перезаписати файл чи дописувати в кінець. */
+        enum class Mode
+        {
+            Truncate,
+            Append
+        };
+
+        /** @brief Закритий файл. */
+        DurableFile();
+
+        /**
+         * @brief Відкриває файл, створюючи його за потреби.
+         * @throws std::runtime_error якщо файл не вдалося відкрити.
+         */
+        DurableFile(const std::string& fullPath, Mode mode);
+
+        DurableFile(const DurableFile&) = delete;
+        DurableFile& operator=(const DurableFile&) = delete;
+
+        /** @brief Деструктор (закриває файл без Sync). */
+        ~DurableFile() noexcept;
+
+        /**
+         * @brief Відкриває файл; попередній закривається без Sync.
+         * @throws std::runtime_error якщо файл не вдалося відкрити.
+         */
+        void Open(const std::string& fullPath, Mode mode);
+
+        [[nodiscard]] bool IsOpen() const;
+
+        /**
+         * @brief Дописує дані повністю (з повтором часткових записів).
+         * @throws std::runtime_error якщо запис не вдався.
+         */
+        void Write(std::string_view data);
+
+        /**
+         * @brief Скидає записане на носій (fsync).
+         * @throws std::runtime_error якщо скинути не вдалося.
+         */
+        void Sync();
+
+        /**
+         * @brief Закриває файл; повторний виклик нічого не робить.
+         * @throws std::runtime_error якщо закриття повідомило про помилку запису.
+         */
+        void Close();
+
+        /**
+         * @brief Скидає на носій сам каталог, щоб перейменування чи створення
+         * файлу в ньому пережило збій.
+         * @param directoryPath Шлях до каталогу (порожній — поточний).
+         * @throws std::runtime_error якщо каталог не вдалося скинути.
+         */
+        static void SyncDirectory(const std::string& directoryPath);
+    };
+}
@@ -61,7 +61,7 @@ namespace FootballManagement
         [[nodiscard]] int GetTotalAssists() const;
         [[nodiscard]] int GetTotalShots() const;
         [[nodiscard]] int GetTotalTackles() const;
-        [[nodiscard]] Position GetPosition() const;
+        [[nodiscard]] Position GetPosition() const override;
 
         void SetPosition(Position position);
 
@@ -107,7 +107,15 @@ namespace FootballManagement
         [[nodiscard]] double CalculatePerformanceRating() const override = 0;
         [[nodiscard]] std::string GetStatus() const override = 0;
 
-        [[nodiscard]] std::string Serialize() const override = 0;
+        void AppendTo(OutputBuffer& out) const override = 0;
         void Deserialize(const std::string& data) override = 0;
+
+        void WriteBinary(BinaryWriter& writer) const override;
+        void ReadBinary(BinaryReader& reader) override;
+        void WriteColumns(RosterRow& row) const override;
+
+    protected:
+        bool DeserializeField(std::uint64_t keyHash,
+                              std::string_view value) override;
     };
 }
@@ -4,7 +4,12 @@
 #include <vector>
 #include <memory>
 #include <fstream>
+#include <functional>
 #include "IFileHandler.h"
+#include "ISnapshotHandler.h"
+#include "MappedFile.h"
+#include "RecordReader.h"
+#include "RosterSnapshot.h"
 #include "Utils.h"
 
 namespace FootballManagement
@@ -16,13 +21,34 @@ namespace FootballManagement
     {
     private:
         std::string directoryPath_ = "data/";
+        SnapshotFormat snapshotFormat_ = SnapshotFormat::Text;
+        std::size_t flushBytes_ = RecordSink::DEFAULT_FLUSH_BYTES;
+        std::size_t readBufferBytes_ = RecordReader::DEFAULT_BUFFER_BYTES;
+        ReadProgressCallback onReadProgress_;
+        bool parallelLoad_ = false;
+
+        /**
+         * @brief Атомарно і надійно записує файл: тимчасовий файл скидається на
+         * диск (fsync) перед перейменуванням, а каталог — після нього.
+         * @param write Пише вміст у приймач, відкритий на тимчасовий файл.
+         */
+        bool WriteAtomically(const std::string& fileName,
+                             const std::function<void(RecordSink&)>& write) const;
+
+        /**
+         * @brief Атомарно записує готові дані у файл.
+         */
+        bool WriteAtomically(const std::string& fileName,
+                             std::string_view data) const;
 
     public:
         FileManager() = default;
         ~FileManager() = default;
 
         /**
-         * @brief Зберігає вміст одного об'єкта у файл.
+         * @brief Атомарно зберігає вміст одного об'єкта у файл (тимчасовий файл + перейменування).
+         * Об'єкт пишеться потоково (IFileHandler::WriteTo) порціями по
+         * GetFlushBytes() байтів, без побудови всього файлу в пам'яті.
          * @param fileName Ім'я файлу.
          * @param serializableObject Об'єкт для серіалізації.
          * @return bool Результат операції.
@@ -30,6 +56,103 @@ namespace FootballManagement
         bool SaveToFile(const std::string& fileName,
                         const IFileHandler& serializableObject) const;
 
+        /**
+         * @brief Встановлює розмір порції, якою потокове збереження пише на диск.
+         * @param flushBytes Кількість байтів (0 — кожен запис окремо).
+         */
+        void SetFlushBytes(std::size_t flushBytes);
+
+        /** @brief Поточний розмір порції потокового збереження. */
+        std::size_t GetFlushBytes() const;
+
+        /**
+         * @brief Встановлює розмір буфера, яким ReadRecords (і LoadSnapshot) читає файли.
+         */
+        void SetReadBufferBytes(std::size_t bufferBytes);
+
+        /** @brief Поточний розмір буфера потокового читання. */
+        std::size_t GetReadBufferBytes() const;
+
+        /**
+         * @brief Встановлює зворотний виклик прогресу потокового читання.
+         * @param onProgress Викликається після кожного блоку; false зупиняє читання.
+         */
+        void SetReadProgressCallback(ReadProgressCallback onProgress);
+
+        /**
+         * @brief Вмикає паралельний розбір текстових знімків у LoadSnapshot.
+         * Файл тоді відображається в пам'ять цілком і передається в
+         * ISnapshotHandler::DeserializeText: це швидше на багатоядерних
+         * машинах, але пік пам'яті включає весь файл.
+         */
+        void SetParallelLoad(bool enabled);
+
+        /** @brief Чи розбирає LoadSnapshot текстові знімки паралельно. */
+        bool IsParallelLoad() const;
+
+        /**
+         * @brief Відкриває файл для потокового читання записів.
+         * Пам'ять обмежена буфером GetReadBufferBytes(), а не розміром файлу.
+         * @param fileName Ім'я файлу.
+         * @return RecordReader Джерело записів: порожнє, якщо файл відсутній;
+         * у стані Failed(), якщо файл існує, але не відкрився.
+         */
+        RecordReader ReadRecords(const std::string& fileName) const;
+
+        /**
+         * @brief Встановлює формат, у якому SaveSnapshot записує знімки.
+         */
+        void SetSnapshotFormat(SnapshotFormat format);
+
+        /** @brief Поточний формат запису знімків. */
+        SnapshotFormat GetSnapshotFormat() const;
+
+        /**
+         * @brief Атомарно зберігає повний знімок у вибраному форматі (SetSnapshotFormat).
+         * @param fileName Ім'я файлу.
+         * @param snapshot Об'єкт для збереження.
+         * @return bool Результат операції.
+         */
+        bool SaveSnapshot(const std::string& fileName,
+                          const ISnapshotHandler& snapshot) const;
+
+        /**
+         * @brief Атомарно зберігає знімок складу (ClubManager::Snapshot) у вибраному форматі.
+         * @param fileName Ім'я файлу.
+         * @param roster Знімок складу.
+         * @return bool Результат операції.
+         */
+        bool SaveSnapshot(const std::string& fileName,
+                          const RosterSnapshot& roster) const;
+
+        /**
+         * @brief Завантажує знімок, визначаючи формат за сигнатурою файлу.
+         * Текстовий знімок читається потоково (ReadRecords): записи
+         * розбираються по мірі читання, без копії всього файлу в пам'яті
+         * (або паралельно з відображення файлу, див. SetParallelLoad).
+         * @param fileName Ім'я файлу.
+         * @param snapshot Об'єкт, у який завантажуються дані.
+         * Склад об'єкта змінюється лише після успішного завантаження;
+         * порожнім його робить тільки відсутній файл.
+         * @return bool False, якщо знімок пошкоджений, не відкрився, не дочитаний
+         * через помилку читання або читання зупинено.
+         */
+        bool LoadSnapshot(const std::string& fileName,
+                          ISnapshotHandler& snapshot) const;
+
+        /**
+         * @brief Конвертує знімок між текстовим і бінарним форматами.
+         * @param sourceFile Вихідний файл (формат визначається автоматично).
+         * @param targetFile Файл результату.
+         * @param targetFormat Формат результату.
+         * @param buffer Тимчасовий об'єкт, через який проходять дані (наприклад, порожній ClubManager).
+         * @return bool Результат операції.
+         */
+        bool ConvertSnapshot(const std::string& sourceFile,
+                             const std::string& targetFile,
+                             SnapshotFormat targetFormat,
+                             ISnapshotHandler& buffer) const;
+
         /**
          * @brief Зчитує вміст файлу та повертає його як вектор рядків.
          * @param fileName
@@ -38,6 +161,20 @@ namespace FootballManagement
         std::vector<std::string>
         LoadFromFile(const std::string& fileName) const;
 
+        /**
+         * @brief Відображає файл у пам'ять без копіювання даних.
+         * Рядки доступні через MappedFile::Lines() як std::string_view.
+         * @param fileName Ім'я файлу.
+         * @return MappedFile Відображення (порожнє, якщо файл відсутній або сталася помилка).
+         */
+        MappedFile MapFile(const std::string& fileName) const;
+
+        /**
+         * @brief Виводить вміст файлу в консоль.
+         * @param fileName Ім'я файлу.
+         */
+        void DisplayFileContent(const std::string& fileName) const;
+
         /**
          * @brief Перевіряє існування файлу.
          * @param fileName Ім'я файлу.
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "FieldPlayer.h"
+#include <span>
 #include <string>
 
 
@@ -17,6 +18,11 @@ namespace FootballManagement
         int monthsWithoutClub_;
         bool availableForNegotiation_;
 
+        /** @brief Формула рейтингу без віртуального виклику (для пакетних обчислень). */
+        [[nodiscard]] double RatingFormula() const;
+
+        /** @brief Формула вартості без віртуальних викликів. */
+        [[nodiscard]] double ValueFormula() const;
 
     public:
         /** @brief Конструктор за замовчуванням. */
@@ -104,10 +110,34 @@ namespace FootballManagement
         void ShowInfo() const override;
         double CalculateValue() const override;
         std::string GetStatus() const override;
+        PlayerStatus GetStatusFlags() const override;
         void CelebrateBirthday() override;
         double CalculatePerformanceRating() const override;
 
-        std::string Serialize() const override;
+        void AppendTo(OutputBuffer& out) const override;
         void Deserialize(const std::string& data) override;
+
+        PlayerRecordTag GetRecordTag() const override;
+        std::shared_ptr<Player> Clone() const override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        void ReadBinary(BinaryReader& reader) override;
+        void WriteColumns(RosterRow& row) const override;
+
+        /**
+         * @brief Рейтинги пакета вільних агентів без віртуальних викликів.
+         * Динамічний тип кожного елемента — саме FreeAgent (див. PlayerBatches).
+         * @param players Пакет гравців.
+         * @param out Результати у тому ж порядку (розмір як у players).
+         */
+        static void RateBatch(std::span<const FreeAgent* const> players,
+                              std::span<double> out);
+
+        /** @brief Ринкова вартість (CalculateValue) пакета вільних агентів; умови як у RateBatch. */
+        static void ValueBatch(std::span<const FreeAgent* const> players,
+                               std::span<double> out);
+
+    protected:
+        bool DeserializeField(std::uint64_t keyHash,
+                              std::string_view value) override;
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Player.h"
+#include <span>
 #include <string>
 
 namespace FootballManagement
@@ -18,6 +19,12 @@ namespace FootballManagement
         int goalsConceded_;
         int penaltiesSaved_;
 
+        /** @brief Формула рейтингу без віртуального виклику (для пакетних обчислень). */
+        [[nodiscard]] double RatingFormula() const;
+
+        /** @brief Формула вартості для вже обчисленого рейтингу. */
+        [[nodiscard]] double ValueFormula(double rating) const;
+
     public:
         /** @brief Конструктор за замовчуванням. */
         Goalkeeper();
@@ -53,7 +60,7 @@ namespace FootballManagement
 
         int GetMatchesPlayed() const;
         int GetCleanSheets() const;
-        static void GetSavesTotal();
+        int GetSavesTotal() const;
         int GetGoalsConceded() const;
         int GetPenaltiesSaved() const;
 
@@ -100,6 +107,12 @@ namespace FootballManagement
         /** @brief Повертає статус гравця (Active / Injured). */
         std::string GetStatus() const override;
 
+        /** @brief Прапорці стану: Goalkeeper і, можливо, Injured. */
+        PlayerStatus GetStatusFlags() const override;
+
+        /** @brief Позиція воротаря завжди Position::Goalkeeper. */
+        Position GetPosition() const override;
+
         /** @brief Збільшує вік на 1 рік і виводить повідомлення. */
         void CelebrateBirthday() override;
 
@@ -107,9 +120,32 @@ namespace FootballManagement
         double CalculatePerformanceRating() const override;
 
         /** @brief Серіалізує об’єкт у текстовий формат. */
-        std::string Serialize() const override;
+        void AppendTo(OutputBuffer& out) const override;
 
         /** @brief Десеріалізує об’єкт із рядка. */
         void Deserialize(const std::string& data) override;
+
+        PlayerRecordTag GetRecordTag() const override;
+        std::shared_ptr<Player> Clone() const override;
+        void WriteBinary(BinaryWriter& writer) const override;
+        void ReadBinary(BinaryReader& reader) override;
+        void WriteColumns(RosterRow& row) const override;
+
+        /**
+         * @brief Рейтинги пакета воротарів без віртуальних викликів.
+         * Динамічний тип кожного елемента — саме Goalkeeper (див. PlayerBatches).
+         * @param players Пакет гравців.
+         * @param out Результати у тому ж порядку (розмір як у players).
+         */
+        static void RateBatch(std::span<const Goalkeeper* const> players,
+                              std::span<double> out);
+
+        /** @brief Ринкова вартість (CalculateValue) пакета воротарів; умови як у RateBatch. */
+        static void ValueBatch(std::span<const Goalkeeper* const> players,
+                               std::span<double> out);
+
+    protected:
+        bool DeserializeField(std::uint64_t keyHash,
+                              std::string_view value) override;
     };
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include "OutputBuffer.h"
+#include "RecordSink.h"
 
 namespace FootballManagement
 {
@@ -16,6 +18,27 @@ namespace FootballManagement
          */
         [[nodiscard]] virtual std::string Serialize() const = 0;
 
+        /**
+         * @brief Дописує серіалізоване представлення в буфер викликача.
+         * Базова версія дописує Serialize(); класи, які зберігаються часто,
+         * перевизначають метод, а Serialize() роблять обгорткою над ним.
+         * @param out Буфер, у кінець якого дописуються дані.
+         */
+        virtual void AppendTo(OutputBuffer& out) const { out.Append(Serialize()); }
+
+        /**
+         * @brief Пише об'єкт у приймач записів порціями (потокове збереження).
+         * Базова версія пише все представлення одним записом; великі
+         * колекції перевизначають метод і пишуть запис за записом, тож
+         * пам'ять не залежить від розміру файлу.
+         * @param sink Приймач, у який пишуться дані.
+         */
+        virtual void WriteTo(RecordSink& sink) const
+        {
+            AppendTo(sink.Buffer());
+            sink.EndRecord();
+        }
+
         /**
          * @brief Десеріалізує об'єкт із рядкового представлення.
          *  @param data Рядок з даними, на основі яких здійснюється відновлення об’єкта.
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Інтерфейс джерела записів (рядків) для десеріалізаторів.
+     * Дозволяє читати дані з вектора рядків, відображеного у пам'ять файлу тощо,
+     * не копіюючи їх у проміжні контейнери.
+     */
+    class IRecordSource
+    {
+    public:
+        /**
+         * @brief Повертає наступний непорожній запис.
+         * @param record Вид на запис; дійсний лише до наступного виклику
+         * NextRecord (джерело може перевикористати свій буфер), тож запис,
+         * потрібний довше, слід скопіювати.
+         * @return bool False, якщо записів більше немає.
+         */
+        virtual bool NextRecord(std::string_view& record) = 0;
+
+        /**
+         * @brief Оцінка кількості записів (0, якщо невідомо).
+         * Використовується для попереднього резервування пам'яті.
+         */
+        [[nodiscard]] virtual std::size_t SizeHint() const = 0;
+
+        /**
+         * @brief Чи обірвано читання до кінця даних (тоді записів отримано не всі).
+         */
+        [[nodiscard]] virtual bool Cancelled() const { return false; }
+
+        /**
+         * @brief Чи обірвала читання помилка введення-виведення (тоді записів
+         * отримано не всі, а кінець даних не досягнуто).
+         */
+        [[nodiscard]] virtual bool Failed() const { return false; }
+
+        /**
+        * @brief Віртуальний деструктор.
+        */
+        virtual ~IRecordSource() = default;
+    };
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include "IFileHandler.h"
+#include "IRecordSource.h"
+#include "RecordSources.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Інтерфейс для об'єктів, що зберігаються як повний знімок
+     * у текстовому або бінарному форматі (див. SnapshotFormat).
+     */
+    class ISnapshotHandler : public IFileHandler
+    {
+    public:
+        /**
+         * @brief Серіалізує об'єкт у бінарний знімок.
+         * @return Повний вміст файлу знімка.
+         */
+        [[nodiscard]] virtual std::string SerializeBinary() const = 0;
+
+        /**
+         * @brief Відновлює об'єкт із бінарного знімка.
+         * @param data Повний вміст файлу знімка.
+         */
+        virtual void DeserializeBinary(std::string_view data) = 0;
+
+        /**
+         * @brief Відновлює об'єкт із текстових записів (рядків файлу).
+         * @param records Джерело записів.
+         */
+        virtual void DeserializeRecords(IRecordSource& records) = 0;
+
+        /**
+         * @brief Відновлює об'єкт із повного тексту знімка, що вже в пам'яті.
+         * Базова версія читає рядки послідовно через DeserializeRecords;
+         * реалізації можуть розбирати записи паралельно.
+         * @param data Повний вміст текстового знімка.
+         */
+        virtual void DeserializeText(std::string_view data)
+        {
+            LineRange lines(data);
+            DeserializeRecords(lines);
+        }
+    };
+}
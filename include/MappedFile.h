@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "RecordSources.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Файл, відображений у пам'ять лише для читання (RAII).
+     *
+     * Дані не копіюються: рядки, отримані через Lines(), вказують
+     * безпосередньо у відображення і дійсні, доки живе об'єкт.
+     * На платформах без mmap вміст зчитується в один внутрішній буфер.
+     */
+    class MappedFile
+    {
+    private:
+        const char* data_;
+        std::size_t size_;
+        std::string fallbackBuffer_;
+
+        void Release() noexcept;
+
+    public:
+        /** @brief Порожнє відображення. */
+        MappedFile();
+
+        /**
+         * @brief Відображає файл у пам'ять.
+         * @param fullPath Повний шлях до файлу.
+         * @throws std::runtime_error якщо файл не вдалося відкрити чи відобразити.
+         */
+        explicit MappedFile(const std::string& fullPath);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /** @brief Переміщувальний конструктор. */
+        MappedFile(MappedFile&& other) noexcept;
+
+        /** @brief Оператор переміщувального присвоєння. */
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /** @brief Деструктор (звільняє відображення). */
+        ~MappedFile() noexcept;
+
+        /** @brief Увесь вміст файлу. */
+        [[nodiscard]] std::string_view Data() const;
+
+        /** @brief Розмір файлу в байтах. */
+        [[nodiscard]] std::size_t Size() const;
+
+        /** @brief Чи немає даних (файл відсутній або порожній). */
+        [[nodiscard]] bool Empty() const;
+
+        /**
+         * @brief Діапазон непорожніх рядків файлу у вигляді std::string_view.
+         */
+        [[nodiscard]] LineRange Lines() const;
+    };
+}
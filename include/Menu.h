@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include "AuthManager.h"
+#include "AutoSaver.h"
 #include "ClubManager.h"
 #include "InputValidator.h"
 #include "FileManager.h"
@@ -19,7 +20,10 @@ namespace FootballManagement
     {
     private:
         std::shared_ptr<ClubManager> clubManager_;
+        std::shared_ptr<AutoSaver> autoSaver_;
         FileManager fileManager_;
+        /// @brief Останнє завантаження гравців не вдалося — склад не перезаписується.
+        mutable bool playersLoadFailed_ = false;
         bool isRunning_;
 
         void displayMainMenu() const;
@@ -44,8 +48,10 @@ namespace FootballManagement
         /**
           * @brief Конструктор класу Menu.
           * @param clubManager Вказівник на об'єкт менеджера клубу.
+          * @param autoSaver Фонове автозбереження складу (може бути nullptr).
           */
-        explicit Menu(std::shared_ptr<ClubManager> clubManager);
+        explicit Menu(std::shared_ptr<ClubManager> clubManager,
+                      std::shared_ptr<AutoSaver> autoSaver = nullptr);
 
         virtual ~Menu() = default;
 
@@ -66,6 +72,7 @@ namespace FootballManagement
 
         /**
          * @brief Зберігає всі дані (користувачів та гравців).
+         * З автозбереженням у журнал дописуються лише змінені гравці.
          */
         void SaveAllData() const;
 
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Інвертований n-грамний індекс для пошуку гравців за підрядком імені.
+     *
+     * Імена зберігаються вже приведеними до нижнього регістру (FoldCase, з
+     * підтримкою кирилиці), тож при запиті згортається лише сам запит.
+     * N-грами будуються за кодовими точками UTF-8, а не за байтами, тож
+     * кириличні триграми так само вибіркові, як і латинські. Для кожної біграми та триграми зберігається
+     * відсортований список документів, у яких вона трапляється:
+     * - запит із двох символів — це рівно список його біграми;
+     * - довший запит перевіряє лише перетин списків двох найрідших триграм;
+     * - односимвольний запит переглядає збережені імена без перетворення регістру.
+     *
+     * Видалення позначає документ мертвим; коли мертвих стає більше, ніж живих,
+     * індекс перебудовується.
+     */
+    class NameIndex
+    {
+    private:
+        std::vector<std::string> folded_;
+        std::vector<int> playerIds_;
+        std::vector<bool> alive_;
+        std::unordered_map<int, std::uint32_t> docById_;
+        std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> postings_;
+        std::size_t deadCount_;
+
+        static void DecodeCodePoints(std::string_view text,
+                                     std::vector<std::uint32_t>& codePoints);
+        static std::uint64_t GramKey(const std::uint32_t* codePoints,
+                                     std::size_t length);
+
+        void AddPosting(std::uint64_t key, std::uint32_t doc);
+        void IndexDocument(std::uint32_t doc);
+        void Compact();
+
+    public:
+        NameIndex();
+
+        /**
+         * @brief Приводить ім'я до форми, у якій воно зберігається в індексі (FoldCase).
+         * @param name Ім'я або запит.
+         * @return std::string Ім'я в нижньому регістрі.
+         */
+        static std::string Fold(std::string_view name);
+
+        /**
+         * @brief Додає або оновлює ім'я гравця.
+         * @param playerId ID гравця.
+         * @param name Ім'я (у довільному регістрі).
+         */
+        void Insert(int playerId, std::string_view name);
+
+        /**
+         * @brief Видаляє гравця з індексу (якщо він там є).
+         * @param playerId ID гравця.
+         */
+        void Erase(int playerId);
+
+        /** @brief Чи є гравець в індексі. */
+        [[nodiscard]] bool Contains(int playerId) const;
+
+        /**
+         * @brief Переносить документи іншого індексу в кінець цього.
+         *
+         * Списки n-грам дописуються зі зсувом номерів документів, без
+         * повторного розбору імен, тож індекси частин даних можна будувати
+         * паралельно й потім з'єднати. Гравці, які вже є в цьому індексі,
+         * у перенесених документах вважаються видаленими.
+         * @param other Індекс, що спорожнюється після перенесення.
+         */
+        void Append(NameIndex&& other);
+
+        /** @brief Очищує індекс. */
+        void Clear();
+
+        /**
+         * @brief Резервує місце під очікувану кількість імен.
+         */
+        void Reserve(std::size_t count);
+
+        /**
+         * @brief Знаходить гравців, чиє ім'я містить запит (без урахування регістру).
+         * @param query Підрядок імені.
+         * @param limit Максимальна кількість результатів (0 — без обмеження).
+         * @return std::vector<int> ID гравців у порядку додавання до індексу.
+         */
+        [[nodiscard]] std::vector<int> Search(std::string_view query,
+                                              std::size_t limit = 0) const;
+
+        /** @brief Кількість імен в індексі. */
+        [[nodiscard]] std::size_t Size() const;
+    };
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Впорядкований вторинний індекс числового поля гравців.
+     *
+     * Пари (значення, ID) зберігаються як рівень листків B+-дерева:
+     * послідовність відсортованих блоків обмеженого розміру, впорядкованих
+     * між собою. Пошук межі діапазону — двійковий пошук по блоках і всередині
+     * блока, O(log n); вставка й видалення зсувають не більше одного блока;
+     * обхід діапазону — O(log n + k) по суцільній пам'яті. Окрема хеш-таблиця
+     * ID -> значення дозволяє знайти стару пару при оновленні.
+     */
+    class NumericIndex
+    {
+    public:
+        /**
+         * @brief Елемент індексу; порядок — значення, потім ID.
+         */
+        struct Entry
+        {
+            double key;
+            int playerId;
+        };
+
+    private:
+        /// @brief Блок ділиться навпіл, коли перевищує цей розмір.
+        static constexpr std::size_t MAX_BLOCK_SIZE = 512;
+
+        std::vector<std::vector<Entry>> blocks_;
+        std::unordered_map<int, double> keyById_;
+        std::size_t size_ = 0;
+
+        /** @brief Позиція в індексі: номер блока і зсув у ньому. */
+        struct Cursor
+        {
+            std::size_t block;
+            std::size_t offset;
+        };
+
+        /** @brief Перша позиція, елемент якої не менший за entry (або кінець). */
+        [[nodiscard]] Cursor LowerBound(const Entry& entry) const;
+
+        /** @brief Перша позиція, елемент якої більший за entry (або кінець). */
+        [[nodiscard]] Cursor UpperBound(const Entry& entry) const;
+
+        void Insert(const Entry& entry);
+        void Remove(const Entry& entry);
+
+    public:
+        /**
+         * @brief Додає гравця або оновлює його значення.
+         * @param playerId ID гравця.
+         * @param key Значення поля.
+         */
+        void Upsert(int playerId, double key);
+
+        /**
+         * @brief Додає або оновлює багатьох гравців за один прохід.
+         * Коли змін небагато, вони застосовуються по одній; інакше рівень
+         * листків перебудовується злиттям за O(n + m log m).
+         * @param entries Нові значення; для повторюваного ID діє останнє.
+         */
+        void UpsertBatch(std::span<const Entry> entries);
+
+        /** @brief Видаляє гравця з індексу (якщо він є). */
+        void Erase(int playerId);
+
+        void Clear();
+        void Reserve(std::size_t count);
+        [[nodiscard]] std::size_t Size() const;
+
+        /** @brief Значення поля гравця або std::nullopt, якщо його немає в індексі. */
+        [[nodiscard]] std::optional<double> KeyOf(int playerId) const;
+
+        /**
+         * @brief Обходить гравців зі значенням у [minKey, maxKey] у порядку значення;
+         * при рівних значеннях — ID за зростанням (в обох напрямках).
+         * @param descending Обхід від більших значень до менших.
+         * @param visit Отримує ID; повертає false, щоб зупинити обхід.
+         */
+        void ForEachInRange(double minKey, double maxKey, bool descending,
+                            const std::function<bool(int)>& visit) const;
+
+        /**
+         * @brief Кількість гравців зі значенням у [minKey, maxKey]
+         * за O(log n + кількість охоплених блоків).
+         */
+        [[nodiscard]] std::size_t CountInRange(double minKey, double maxKey) const;
+
+        /**
+         * @brief ID гравців зі значенням у [minKey, maxKey] за зростанням значення.
+         */
+        [[nodiscard]] std::vector<int> Range(double minKey, double maxKey) const;
+    };
+}
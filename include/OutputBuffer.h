@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Буфер, що росте, для серіалізації без проміжних рядків.
+     *
+     * Числа пишуться через std::to_chars прямо в пам'ять буфера; Clear() не
+     * звільняє її, тож буфер, який використовується повторно, після першого
+     * запису не виділяє пам'ять зовсім. Дійсні числа записуються найкоротшим
+     * представленням, яке точно відновлюється з тексту.
+     */
+    class OutputBuffer
+    {
+    private:
+        /// @brief Сховище; його розмір — місткість буфера.
+        std::string data_;
+        /// @brief Кількість записаних байтів.
+        std::size_t size_ = 0;
+
+        /**
+         * @brief Гарантує місце ще для extra байтів.
+         * @return char* Позиція запису (кінець записаних даних).
+         */
+        char* Grow(std::size_t extra);
+
+    public:
+        OutputBuffer() = default;
+
+        /** @brief Буфер із наперед виділеною місткістю. */
+        explicit OutputBuffer(std::size_t capacity);
+
+        [[nodiscard]] std::size_t Size() const { return size_; }
+        [[nodiscard]] bool Empty() const { return size_ == 0; }
+        [[nodiscard]] std::size_t Capacity() const { return data_.size(); }
+
+        /** @brief Записані дані (дійсні до наступного запису в буфер). */
+        [[nodiscard]] std::string_view View() const { return {data_.data(), size_}; }
+
+        void Reserve(std::size_t capacity);
+
+        /** @brief Очищує вміст, зберігаючи виділену пам'ять. */
+        void Clear() { size_ = 0; }
+
+        /**
+         * @brief Забирає вміст як рядок без копіювання; буфер стає порожнім.
+         */
+        [[nodiscard]] std::string Take();
+
+        OutputBuffer& Append(std::string_view text);
+        OutputBuffer& Append(char c);
+        OutputBuffer& AppendInt(long long value);
+        OutputBuffer& AppendDouble(double value);
+
+        /** @brief Записує true або false. */
+        OutputBuffer& AppendBool(bool value);
+
+        /** @brief Записує "text" (без екранування — як і формат записів). */
+        OutputBuffer& AppendQuoted(std::string_view text);
+
+        /** @brief Записує "key": — початок поля запису. */
+        OutputBuffer& AppendKey(std::string_view key);
+    };
+}
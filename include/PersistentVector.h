@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Постійний (persistent) вектор — префіксне дерево з розгалуженням 32.
+     *
+     * Копія вектора займає O(1): копіюється лише покажчик на корінь, а вузли
+     * стають спільними. Зміна копіює шлях від кореня до листа, тільки якщо
+     * вузол на ньому спільний з іншою версією (O(log32 n) вузлів); вузли,
+     * якими версія володіє одноосібно, змінюються на місці. Тож пам'ять
+     * зростає пропорційно до кількості змін після останньої копії.
+     *
+     * Читати різні версії можна з різних потоків одночасно; змінювати одну
+     * версію може лише один потік.
+     */
+    template <typename T>
+    class PersistentVector
+    {
+    private:
+        static constexpr std::size_t BITS = 5;
+        static constexpr std::size_t WIDTH = std::size_t{1} << BITS;
+        static constexpr std::size_t MASK = WIDTH - 1;
+
+        struct Node;
+        using NodePtr = std::shared_ptr<Node>;
+        using Branch = std::array<NodePtr, WIDTH>;
+        using Leaf = std::array<T, WIDTH>;
+
+        struct Node
+        {
+            std::variant<Branch, Leaf> slots;
+        };
+
+        NodePtr root_;
+        std::size_t size_ = 0;
+        /// @brief Зсув індексу для кореня: BITS * (висота дерева - 1).
+        std::size_t shift_ = 0;
+
+        /**
+         * @brief Вузол, яким ця версія володіє одноосібно (копіює спільний,
+         * створює відсутній).
+         */
+        static Node& Writable(NodePtr& node, std::size_t level)
+        {
+            if (!node)
+            {
+                node = level == 0 ? std::make_shared<Node>(Node{Leaf{}})
+                                  : std::make_shared<Node>(Node{Branch{}});
+            }
+            else if (node.use_count() > 1)
+            {
+                node = std::make_shared<Node>(*node);
+            }
+            else
+            {
+                // Інша версія могла щойно відпустити вузол в іншому потоці:
+                // її читання мають завершитися до наших записів.
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *node;
+        }
+
+        /** @brief Елемент index з правом запису (шлях до нього копіюється за потреби). */
+        T& WritableAt(std::size_t index)
+        {
+            NodePtr* node = &root_;
+            for (std::size_t level = shift_; level > 0; level -= BITS)
+            {
+                Branch& branch = std::get<Branch>(Writable(*node, level).slots);
+                node = &branch[(index >> level) & MASK];
+            }
+            return std::get<Leaf>(Writable(*node, 0).slots)[index & MASK];
+        }
+
+        /**
+         * @brief Звільняє останній елемент піддерева.
+         * @return bool True, якщо піддерево стало порожнім і його можна відрізати.
+         */
+        static bool PopFrom(NodePtr& node, std::size_t level, std::size_t index)
+        {
+            if (level == 0)
+            {
+                std::get<Leaf>(Writable(node, 0).slots)[index & MASK] = T{};
+                return (index & MASK) == 0;
+            }
+
+            const std::size_t child = (index >> level) & MASK;
+            Branch& branch = std::get<Branch>(Writable(node, level).slots);
+            if (PopFrom(branch[child], level - BITS, index))
+                branch[child].reset();
+            return child == 0 && !branch[0];
+        }
+
+        template <typename Visit>
+        static void VisitNode(const Node& node, std::size_t level,
+                              std::size_t& remaining, Visit& visit)
+        {
+            if (level == 0)
+            {
+                const Leaf& leaf = std::get<Leaf>(node.slots);
+                for (std::size_t i = 0; i < WIDTH && remaining > 0; ++i, --remaining)
+                    visit(leaf[i]);
+                return;
+            }
+
+            const Branch& branch = std::get<Branch>(node.slots);
+            for (std::size_t i = 0; i < WIDTH && remaining > 0; ++i)
+                VisitNode(*branch[i], level - BITS, remaining, visit);
+        }
+
+    public:
+        [[nodiscard]] std::size_t Size() const { return size_; }
+        [[nodiscard]] bool Empty() const { return size_ == 0; }
+
+        /**
+         * @brief Елемент за індексом за O(log32 n).
+         * @throws std::out_of_range якщо index >= Size().
+         */
+        [[nodiscard]] const T& At(std::size_t index) const
+        {
+            if (index >= size_)
+                throw std::out_of_range("Індекс поза межами постійного вектора.");
+
+            const Node* node = root_.get();
+            for (std::size_t level = shift_; level > 0; level -= BITS)
+                node = std::get<Branch>(node->slots)[(index >> level) & MASK].get();
+            return std::get<Leaf>(node->slots)[index & MASK];
+        }
+
+        /**
+         * @brief Замінює елемент; інші версії вектора його не бачать.
+         * @throws std::out_of_range якщо index >= Size().
+         */
+        void Set(std::size_t index, T value)
+        {
+            if (index >= size_)
+                throw std::out_of_range("Індекс поза межами постійного вектора.");
+            WritableAt(index) = std::move(value);
+        }
+
+        void PushBack(T value)
+        {
+            // Дерево заповнене — над коренем додається новий рівень.
+            if (root_ && size_ == (std::size_t{1} << (shift_ + BITS)))
+            {
+                auto grown = std::make_shared<Node>(Node{Branch{}});
+                std::get<Branch>(grown->slots)[0] = std::move(root_);
+                root_ = std::move(grown);
+                shift_ += BITS;
+            }
+            ++size_;
+            WritableAt(size_ - 1) = std::move(value);
+        }
+
+        /**
+         * @brief Видаляє елемент, зсуваючи наступні на один, за O(Size() - index):
+         * кожен лист після index береться на запис один раз (копіюється,
+         * лише якщо спільний з іншою версією).
+         * @throws std::out_of_range якщо index >= Size().
+         */
+        void Erase(std::size_t index)
+        {
+            if (index >= size_)
+                throw std::out_of_range("Індекс поза межами постійного вектора.");
+
+            // Листи обходяться з кінця: перший елемент кожного листа
+            // переноситься в кінець попереднього.
+            T carry{};
+            for (std::size_t start = (size_ - 1) & ~MASK;; start -= WIDTH)
+            {
+                T* leaf = &WritableAt(start);
+                const std::size_t from = start < index ? index - start : 0;
+                const std::size_t end = std::min(WIDTH, size_ - start);
+                T leaving = std::move(leaf[from]);
+                std::move(leaf + from + 1, leaf + end, leaf + from);
+                leaf[end - 1] = std::move(carry);
+                carry = std::move(leaving);
+                if (start <= index) break;
+            }
+            PopBack();
+        }
+
+        /** @brief Видаляє останній елемент (для порожнього вектора нічого не робить). */
+        void PopBack()
+        {
+            if (size_ == 0) return;
+
+            if (--size_ == 0)
+            {
+                Clear();
+                return;
+            }
+            PopFrom(root_, shift_, size_);
+            // Корінь з одним нащадком заміщується цим нащадком.
+            while (shift_ > 0 && size_ <= (std::size_t{1} << shift_))
+            {
+                NodePtr child = std::get<Branch>(root_->slots)[0];
+                root_ = std::move(child);
+                shift_ -= BITS;
+            }
+        }
+
+        void Clear()
+        {
+            root_.reset();
+            size_ = 0;
+            shift_ = 0;
+        }
+
+        /**
+         * @brief Обходить елементи за порядком індексів (лист за листом, без спусків від кореня).
+         * @param visit Викликається з const T& для кожного елемента.
+         */
+        template <typename Visit>
+        void ForEach(Visit&& visit) const
+        {
+            std::size_t remaining = size_;
+            if (root_) VisitNode(*root_, shift_, remaining, visit);
+        }
+    };
+}
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <typeinfo>
 #include <vector>
 #include "Utils.h"
+#include "PlayerStatus.h"
 #include "IFileHandler.h"
 
 /**
@@ -10,6 +15,10 @@
  */
 namespace FootballManagement
 {
+    class BinaryWriter;
+    class BinaryReader;
+    struct RosterRow;
+
     /**
      * @brief Абстрактний базовий клас для всіх футболістів у системі.
     * Містить базові антропометричні та біографічні дані,
@@ -78,6 +87,7 @@ namespace FootballManagement
 
         void SetPlayerId(int playerId);
         void SetName(const std::string& name);
+        void SetAge(int age);
         void SetNationality(const std::string& nationality);
         void SetOrigin(const std::string& origin);
         void SetHeight(double height);
@@ -93,9 +103,18 @@ namespace FootballManagement
         /** @brief Абстрактний метод — ефективність гравця. */
        [[nodiscard]] virtual double CalculatePerformanceRating() const = 0;
 
-        /** @brief Абстрактний метод — статус (контракт / вільний агент). */
+        /** @brief Абстрактний метод — статус (контракт / вільний агент) для відображення. */
         [[nodiscard]] virtual std::string GetStatus() const = 0;
 
+        /**
+         * @brief Прапорці стану гравця; база встановлює лише Injured.
+         * Нащадки додають до батьківських прапорців свої (тип, оренда тощо).
+         */
+        [[nodiscard]] virtual PlayerStatus GetStatusFlags() const;
+
+        /** @brief Абстрактний метод — ігрова позиція. */
+        [[nodiscard]] virtual Position GetPosition() const = 0;
+
         /** @brief Абстрактний метод — день народження (збільшити вік). */
         virtual void CelebrateBirthday() = 0;
 
@@ -119,14 +138,80 @@ namespace FootballManagement
         void UpdateMarketValue(double percentageChange);
 
 
-        [[nodiscard]] std::string Serialize() const override = 0;
+        /**
+         * @brief Запис гравця одним рядком; обгортка над AppendTo.
+         * Нащадки розширюють формат через AppendTo, а не через цей метод.
+         */
+        [[nodiscard]] std::string Serialize() const final;
+
+        /**
+         * @brief Дописує запис гравця ("key":value через кому) у буфер.
+         * Базова версія пише спільні поля; нащадки дописують свої після неї.
+         */
+        void AppendTo(OutputBuffer& out) const override = 0;
+
         void Deserialize(const std::string& data) override = 0;
 
+        /** @brief Абстрактний метод — тег типу для бінарного знімка. */
+        [[nodiscard]] virtual PlayerRecordTag GetRecordTag() const = 0;
+
+        /**
+         * @brief Записує поля у бінарному форматі.
+         * Нащадки спочатку викликають батьківську версію, потім пишуть свої поля.
+         */
+        virtual void WriteBinary(BinaryWriter& writer) const;
+
+        /**
+         * @brief Зчитує поля у тому ж порядку, у якому їх записав WriteBinary.
+         */
+        virtual void ReadBinary(BinaryReader& reader);
+
+        /**
+         * @brief Незалежна копія гравця того самого типу (для копіювання під час запису
+         * в знімках складу). Кожен тип реалізує її копіювальним конструктором;
+         * нащадок вбудованого типу теж має перевизначити Clone — успадкована
+         * копія кидає std::logic_error (RequireExactType), а не зрізає об'єкт.
+         */
+        [[nodiscard]] virtual std::shared_ptr<Player> Clone() const = 0;
+
+        /**
+         * @brief Заповнює рядок стовпцевого сховища (RosterColumns) числовими полями.
+         * Нащадки спочатку викликають батьківську версію, потім додають свої стовпці.
+         */
+        virtual void WriteColumns(RosterRow& row) const;
+
+        /**
+         * @brief Відновлює об'єкт безпосередньо із запису без копіювання рядка.
+         * @param record Запис у форматі "key":value.
+         */
+        void DeserializeRecord(std::string_view record);
+
     protected:
         /** @brief Серіалізація спільних полів для JSON. */
         [[nodiscard]] std::string SerializeBase() const;
 
-        /** @brief Десеріалізація спільних полів. */
-        void DeserializeBase(const std::string& json);
+        /**
+         * @brief Десеріалізація запису за один прохід.
+         * Кожна пара ключ/значення передається у DeserializeField.
+         */
+        void DeserializeBase(std::string_view json);
+
+        /**
+         * @brief Застосовує одне поле запису до об'єкта.
+         * Нащадки перевизначають метод для своїх полів і делегують решту батьківському класу.
+         * @param keyHash Хеш ключа (HashKey).
+         * @param value Значення без лапок.
+         * @return bool True, якщо ключ розпізнано.
+         */
+        virtual bool DeserializeField(std::uint64_t keyHash,
+                                      std::string_view value);
+
+        /**
+         * @brief Перевіряє в Clone, що об'єкт саме типу cloneType, а не його
+         * нащадок, який не перевизначив Clone (копія зрізала б його до предка).
+         * @param cloneType typeid класу, чий Clone викликано.
+         * @throws std::logic_error якщо динамічний тип об'єкта інший.
+         */
+        void RequireExactType(const std::type_info& cloneType) const;
     };
 }
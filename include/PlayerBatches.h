@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <variant>
+#include <vector>
+#include "ContractedPlayer.h"
+#include "FreeAgent.h"
+#include "Goalkeepeer.h"
+#include "PlayerStatus.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Гравець як закрита множина конкретних типів.
+     * Останній варіант (const Player*) — типи, зареєстровані поза ядром
+     * (PlayerFactory::Register) або похідні від вбудованих; для них лишаються
+     * віртуальні виклики.
+     */
+    using PlayerVariant = std::variant<const Goalkeeper*, const FreeAgent*,
+                                       const ContractedPlayer*, const Player*>;
+
+    /**
+     * @brief Визначає точний динамічний тип гравця.
+     * @param player Гравець.
+     * @return PlayerVariant Покажчик конкретного типу або const Player*.
+     */
+    PlayerVariant ClassifyPlayer(const Player& player);
+
+    /**
+     * @brief Індекс альтернативи PlayerVariant для типу T (стовпець Kinds у RosterColumns).
+     */
+    template <typename T>
+    constexpr std::uint8_t PlayerKindOf()
+    {
+        return static_cast<std::uint8_t>(
+            PlayerVariant(static_cast<const T*>(nullptr)).index());
+    }
+
+    /**
+     * @brief Склад, розкладений на однорідні пакети за конкретним типом.
+     *
+     * Тип кожного гравця визначається один раз (ClassifyPlayer + std::visit).
+     * Далі пакетні ядра (RateBatch / ValueBatch конкретного класу) проходять
+     * однорідний пакет прямими викликами, які компілятор може вбудувати,
+     * замість віртуального виклику на кожного гравця. Результати йдуть у
+     * порядку PlayerIds(): воротарі, вільні агенти, гравці з контрактом, інші.
+     * Пакети не володіють гравцями і дійсні, доки живий склад.
+     */
+    class PlayerBatches
+    {
+    private:
+        std::vector<const Goalkeeper*> goalkeepers_;
+        std::vector<const FreeAgent*> freeAgents_;
+        std::vector<const ContractedPlayer*> contracted_;
+        std::vector<const Player*> others_;
+        std::vector<int> playerIds_;
+
+        /**
+         * @brief Викликає visit(пакет, зсув у PlayerIds()) для кожного пакета.
+         */
+        template <typename Visit>
+        void ForEachBatch(Visit&& visit) const
+        {
+            std::size_t offset = 0;
+            const auto step = [&](const auto& batch)
+            {
+                visit(std::span(batch), offset);
+                offset += batch.size();
+            };
+            step(goalkeepers_);
+            step(freeAgents_);
+            step(contracted_);
+            step(others_);
+        }
+
+    public:
+        /**
+         * @brief Розкладає склад на пакети.
+         * @param players Склад (не змінюється і не зберігається).
+         */
+        explicit PlayerBatches(const std::vector<std::shared_ptr<Player>>& players);
+
+        [[nodiscard]] std::size_t Size() const;
+
+        /** @brief ID гравців у порядку результатів пакетних ядер. */
+        [[nodiscard]] std::span<const int> PlayerIds() const;
+
+        /**
+         * @brief CalculatePerformanceRating() для всіх гравців.
+         * @param out Масив розміру Size() у порядку PlayerIds().
+         * @throws std::invalid_argument якщо розмір out не дорівнює Size().
+         */
+        void Ratings(std::span<double> out) const;
+
+        /**
+         * @brief CalculateValue() для всіх гравців.
+         * @param out Масив розміру Size() у порядку PlayerIds().
+         * @throws std::invalid_argument якщо розмір out не дорівнює Size().
+         */
+        void Values(std::span<double> out) const;
+
+        /** @brief Сума CalculateValue() по складу. */
+        [[nodiscard]] double TotalValue() const;
+
+        /**
+         * @brief ID гравців, чиї прапорці стану задовольняють умову.
+         * @param filter Умова (обов'язкові та виключені прапорці).
+         */
+        [[nodiscard]] std::vector<int> Filter(const StatusFilter& filter) const;
+    };
+}
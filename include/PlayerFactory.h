@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Player.h"
+#include "SlabPool.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Реєстр-фабрика, що створює гравців потрібного типу за тегом запису.
+     *
+     * Реалізовано як Singleton (аналогічно AuthManager). Вбудовані типи
+     * (Goalkeeper, FreeAgent, ContractedPlayer) реєструються у конструкторі,
+     * нові нащадки можна додати через Register. Вбудовані типи створюються
+     * в арені SlabArena свого типу (MakePooled), а не окремим виділенням.
+     */
+    class PlayerFactory
+    {
+    public:
+        /** @brief Функція, що створює порожній об'єкт конкретного типу. */
+        using Creator = std::shared_ptr<Player> (*)();
+
+        /** @brief Арена, у якій Creator створює об'єкти (див. SlabArena::ForType). */
+        using ArenaAccessor = SlabArena& (*)();
+
+    private:
+        std::unordered_map<std::uint64_t, Creator> creators_;
+        std::unordered_map<std::uint8_t, Creator> binaryCreators_;
+
+        /** @brief Тип, що створюється в арені: його Creator і сама арена. */
+        struct PooledType
+        {
+            Creator creator;
+            ArenaAccessor arena;
+        };
+        std::vector<PooledType> pooledTypes_;
+
+        PlayerFactory();
+
+    public:
+        PlayerFactory(const PlayerFactory&) = delete;
+        PlayerFactory& operator=(const PlayerFactory&) = delete;
+
+        /**
+         * @brief Надає єдиний екземпляр фабрики.
+         */
+        static PlayerFactory& GetInstance();
+
+        /**
+         * @brief Реєструє новий тип гравця.
+         * @param typeTag Тег типу, що записується у поле "type".
+         * @param recordTag Тег типу у бінарному знімку.
+         * @param creator Функція створення порожнього об'єкта.
+         * @param arena Арена, у якій creator створює об'єкти (nullptr — купа).
+         */
+        void Register(std::string_view typeTag, PlayerRecordTag recordTag,
+                      Creator creator, ArenaAccessor arena = nullptr);
+
+        /**
+         * @brief Готує арени зареєстрованих типів до завантаження count гравців.
+         * Частка кожного типу — як серед уже живих гравців (порівну, якщо
+         * їх ще немає), тож завантаження не виділяє плит посеред розбору.
+         * @param count Очікувана кількість гравців.
+         */
+        void ReservePooled(std::size_t count) const;
+
+        /**
+         * @brief Створює гравця із запису та заповнює його поля на місці.
+         * @param record Запис, що починається з поля "type".
+         * @return std::shared_ptr<Player> Створений гравець.
+         * @throws std::invalid_argument якщо тег відсутній або невідомий.
+         */
+        [[nodiscard]] std::shared_ptr<Player> Create(
+            std::string_view record) const;
+
+        /**
+         * @brief Створює порожнього гравця за тегом бінарного запису.
+         * @param recordTag Тег типу.
+         * @return std::shared_ptr<Player> Гравець або nullptr, якщо тег невідомий.
+         */
+        [[nodiscard]] std::shared_ptr<Player> Create(
+            PlayerRecordTag recordTag) const;
+    };
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Бітова маска стану гравця.
+     *
+     * Стан зберігається прапорцями, а локалізований текст (GetStatus)
+     * будується з них лише для відображення.
+     */
+    enum class PlayerStatus : std::uint32_t
+    {
+        None = 0,
+        Injured = 1u << 0,
+        OnLoan = 1u << 1,
+        ListedForTransfer = 1u << 2,
+        FreeAgent = 1u << 3,
+        ContractSigned = 1u << 4,
+        Goalkeeper = 1u << 5,
+        Contracted = 1u << 6
+    };
+
+    /// @brief Кількість прапорців у PlayerStatus.
+    constexpr std::size_t PLAYER_STATUS_FLAG_COUNT = 7;
+
+    constexpr PlayerStatus operator|(PlayerStatus a, PlayerStatus b)
+    {
+        return static_cast<PlayerStatus>(static_cast<std::uint32_t>(a) |
+            static_cast<std::uint32_t>(b));
+    }
+
+    constexpr PlayerStatus operator&(PlayerStatus a, PlayerStatus b)
+    {
+        return static_cast<PlayerStatus>(static_cast<std::uint32_t>(a) &
+            static_cast<std::uint32_t>(b));
+    }
+
+    constexpr PlayerStatus& operator|=(PlayerStatus& a, PlayerStatus b)
+    {
+        return a = a | b;
+    }
+
+    /**
+     * @brief Чи встановлені всі прапорці mask у flags.
+     */
+    constexpr bool HasStatus(PlayerStatus flags, PlayerStatus mask)
+    {
+        return (flags & mask) == mask;
+    }
+
+    /**
+     * @brief Умова фільтра: усі прапорці required встановлені, жоден з excluded — ні.
+     */
+    struct StatusFilter
+    {
+        PlayerStatus required = PlayerStatus::None;
+        PlayerStatus excluded = PlayerStatus::None;
+
+        [[nodiscard]] constexpr bool Matches(PlayerStatus flags) const
+        {
+            return HasStatus(flags, required) &&
+                (flags & excluded) == PlayerStatus::None;
+        }
+    };
+
+    /**
+     * @brief Локалізована назва статусу для відображення.
+     * @param flags Прапорці гравця.
+     * @return std::string_view Назва (рядок зі статичним часом життя).
+     */
+    std::string_view DescribeStatus(PlayerStatus flags);
+
+    /**
+     * @brief Перетворює текстовий запит на набір фільтрів за прапорцями.
+     * Запит порівнюється (без урахування регістру, як підрядок) з усіма
+     * локалізованими назвами статусів; кожна відповідна назва дає свій фільтр.
+     * @param query Частина назви статусу.
+     * @return std::vector<StatusFilter> Фільтри, об'єднані через АБО (порожній — збігів немає).
+     */
+    std::vector<StatusFilter> ParseStatusQuery(std::string_view query);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+#include "Player.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Позиція в рейтингу: обчислений один раз рейтинг і ID гравця.
+     */
+    struct RankingEntry
+    {
+        double rating;
+        int playerId;
+    };
+
+    /**
+     * @brief Рейтинг гравців за показником ефективності, що не змінює склад клубу.
+     *
+     * CalculatePerformanceRating() обчислюється рівно один раз на гравця під час
+     * побудови (пакетами PlayerBatches або з готового стовпця рейтингів). Далі впорядковується лише потрібна частина пар (рейтинг, ID):
+     * TopK(k) досортовує префікс через std::partial_sort, тому повторні запити
+     * вже відсортованого префікса виконуються без обчислень.
+     * Порядок: рейтинг за спаданням, при рівності — ID за зростанням.
+     */
+    class RankingView
+    {
+    private:
+        std::vector<RankingEntry> entries_;
+        std::size_t sortedPrefix_;
+
+    public:
+        /**
+         * @brief Обчислює рейтинги всіх гравців.
+         * @param players Склад клубу (не змінюється і не зберігається).
+         */
+        explicit RankingView(const std::vector<std::shared_ptr<Player>>& players);
+
+        /**
+         * @brief Будує рейтинг із уже обчислених значень (наприклад, стовпця RosterColumns).
+         * @param ratings Рейтинги гравців.
+         * @param playerIds ID гравців у тому ж порядку, що й ratings.
+         */
+        RankingView(std::span<const double> ratings, std::span<const int> playerIds);
+
+        /**
+         * @brief Повертає k найкращих позицій рейтингу.
+         * @param k Кількість позицій (обрізається до розміру рейтингу).
+         * @return std::vector<RankingEntry> Позиції у порядку рейтингу.
+         */
+        std::vector<RankingEntry> TopK(std::size_t k);
+
+        /**
+         * @brief Те саме, що TopK, але без копіювання позицій.
+         * Представлення дійсне до наступного виклику TopK, Prefix або Ranked.
+         * @param k Кількість позицій (обрізається до розміру рейтингу).
+         */
+        std::span<const RankingEntry> Prefix(std::size_t k);
+
+        /**
+         * @brief Повністю впорядкований рейтинг.
+         */
+        const std::vector<RankingEntry>& Ranked();
+
+        /** @brief Кількість гравців у рейтингу. */
+        [[nodiscard]] std::size_t Size() const;
+    };
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Набір векторних інструкцій для пакетних ядер.
+     */
+    enum class SimdLevel : std::uint8_t
+    {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    /** @brief Найкращий рівень, який підтримують і процесор, і збірка. */
+    [[nodiscard]] SimdLevel DetectSimdLevel();
+
+    /** @brief Рівень, яким зараз користуються ядра (за замовчуванням — DetectSimdLevel()). */
+    [[nodiscard]] SimdLevel ActiveSimdLevel();
+
+    /**
+     * @brief Примусово вибирає рівень (наприклад, для звірки зі скалярною версією).
+     * @param level Бажаний рівень; обрізається до DetectSimdLevel().
+     * @return SimdLevel Фактично встановлений рівень.
+     */
+    SimdLevel SetSimdLevel(SimdLevel level);
+
+    /** @brief Назва рівня для звітів ("scalar", "sse2", "avx2"). */
+    [[nodiscard]] std::string_view SimdLevelName(SimdLevel level);
+
+    /**
+     * @brief Стовпці статистики воротарів, вирівняні за індексом гравця.
+     */
+    struct GoalkeeperStatColumns
+    {
+        std::span<const std::int32_t> matchesPlayed;
+        std::span<const std::int32_t> saves;
+        std::span<const std::int32_t> cleanSheets;
+        std::span<const std::int32_t> goalsConceded;
+        std::span<const std::int32_t> penaltiesSaved;
+    };
+
+    /*
+     * Пакетні версії формул гравців над суцільними масивами. Кожне ядро
+     * рахує out[i] тими самими операціями і в тому самому порядку, що й
+     * відповідний метод класу, тому результат побітово збігається зі
+     * скалярною версією на будь-якому рівні SimdLevel. Вхідні масиви мають
+     * бути не коротші за out, інакше кидається std::invalid_argument.
+     */
+
+    /** @brief Goalkeeper::CalculateSavePercentage для кожного гравця. */
+    void SavePercentages(std::span<const std::int32_t> saves,
+                         std::span<const std::int32_t> goalsConceded,
+                         std::span<double> out);
+
+    /** @brief FieldPlayer::CalculateConversionRate для кожного гравця. */
+    void ConversionRates(std::span<const std::int32_t> goals,
+                         std::span<const std::int32_t> shots,
+                         std::span<double> out);
+
+    /** @brief Goalkeeper::CalculatePerformanceRating для кожного гравця. */
+    void GoalkeeperRatings(const GoalkeeperStatColumns& stats,
+                           std::span<double> out);
+
+    /** @brief FreeAgent::CalculatePerformanceRating для кожного гравця. */
+    void FreeAgentRatings(std::span<const std::int32_t> monthsWithoutClub,
+                          std::span<double> out);
+
+    /** @brief Goalkeeper::CalculateValue за готовими рейтингами. */
+    void GoalkeeperValues(std::span<const double> marketValues,
+                          std::span<const double> ratings,
+                          std::span<const std::int32_t> cleanSheets,
+                          std::span<double> out);
+
+    /** @brief FreeAgent::CalculateValue для кожного гравця. */
+    void FreeAgentValues(std::span<const double> marketValues,
+                         std::span<const std::int32_t> monthsWithoutClub,
+                         std::span<double> out);
+
+    /** @brief ContractedPlayer::CalculateValue за готовими рейтингами. */
+    void ContractedValues(std::span<const double> marketValues,
+                          std::span<const double> ratings,
+                          std::span<const double> salaries,
+                          std::span<double> out);
+}
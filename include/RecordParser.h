@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Обчислює хеш ключа (FNV-1a) для диспетчеризації через switch.
+     * Функція constexpr, тому її можна використовувати у мітках case.
+     * @param key Ім'я ключа без лапок.
+     * @return std::uint64_t Хеш ключа.
+     */
+    constexpr std::uint64_t HashKey(std::string_view key) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const char c : key)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Одна пара "ключ":значення, знайдена у записі.
+     * Обидва поля вказують у вихідний рядок і не володіють пам'яттю.
+     */
+    struct RecordField
+    {
+        std::string_view key;
+        std::string_view value;
+    };
+
+    /**
+     * @brief Однопрохідний токенізатор записів формату "key":value,
+     * який генерує Player::Serialize.
+     *
+     * Не виділяє пам'ять у купі: ключі та значення повертаються як
+     * std::string_view, числа розбираються через std::from_chars.
+     */
+    class RecordParser
+    {
+    private:
+        std::string_view record_;
+        std::size_t pos_;
+
+    public:
+        /**
+         * @brief Конструктор.
+         * @param record Рядок запису (може містити обрамлюючі фігурні дужки).
+         */
+        explicit RecordParser(std::string_view record) noexcept;
+
+        /**
+         * @brief Повертає наступну пару ключ/значення.
+         * Значення без ключа (старий формат) пропускаються.
+         * @param field Вихідна пара (лапки навколо рядків прибрані).
+         * @return bool False, якщо запис закінчився.
+         */
+        bool Next(RecordField& field) noexcept;
+
+        /**
+         * @brief Розбирає ціле число.
+         * @throws std::invalid_argument якщо значення не є числом повністю
+         * (зокрема з іншими символами після числа).
+         */
+        static int ParseInt(std::string_view value);
+
+        /**
+         * @brief Розбирає дійсне число.
+         * @throws std::invalid_argument якщо значення не є числом повністю
+         * (зокрема з іншими символами після числа).
+         */
+        static double ParseDouble(std::string_view value);
+
+        /**
+         * @brief Розбирає логічне значення ("true"/"1" => true).
+         */
+        static bool ParseBool(std::string_view value) noexcept;
+    };
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include "IRecordSource.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Стан читання для зворотного виклику прогресу.
+     */
+    struct ReadProgress
+    {
+        /// @brief Байтів прочитано з файлу.
+        std::uint64_t bytesRead = 0;
+        /// @brief Розмір файлу на момент відкриття.
+        std::uint64_t totalBytes = 0;
+        /// @brief Записів віддано споживачу.
+        std::size_t records = 0;
+    };
+
+    /**
+     * @brief Викликається після кожного зчитаного блоку.
+     * @return bool False — зупинити читання (NextRecord більше не повертає записів).
+     */
+    using ReadProgressCallback = std::function<bool(const ReadProgress&)>;
+
+    /**
+     * @brief Потокове джерело записів із файлу з буфером фіксованого розміру.
+     *
+     * Читання кероване споживачем: наступний блок зчитується з диска лише
+     * тоді, коли десеріалізатор розібрав усі записи попереднього, тож
+     * повільний споживач сам стримує читання, а пам'ять обмежена буфером
+     * (він росте лише під запис, довший за буфер). Записи — непорожні рядки
+     * без '\n' і кінцевого '\r', як у LineRange; вид на запис дійсний до
+     * наступного виклику NextRecord.
+     */
+    class RecordReader : public IRecordSource
+    {
+    private:
+        std::ifstream file_;
+        std::string buffer_;
+        /// @brief Початок і кінець ще не відданих даних у buffer_.
+        std::size_t begin_ = 0;
+        std::size_t end_ = 0;
+        bool eof_ = true;
+        bool cancelled_ = false;
+        /// @brief Файл не відкрився або читання завершилося помилкою, а не кінцем файлу.
+        bool failed_ = false;
+        ReadProgress progress_;
+        ReadProgressCallback onProgress_;
+        std::size_t sizeHint_ = 0;
+
+        /**
+         * @brief Зсуває залишок на початок буфера і дочитує наступний блок.
+         * @return bool False, якщо нових даних немає.
+         */
+        bool Refill();
+
+    public:
+        /// @brief Розмір буфера за замовчуванням (1 МіБ).
+        static constexpr std::size_t DEFAULT_BUFFER_BYTES = std::size_t{1} << 20;
+
+        /** @brief Порожнє джерело (без записів). */
+        RecordReader() = default;
+
+        /**
+         * @brief Джерело без записів у стані помилки (Failed() == true):
+         * файл існує, але його не вдалося відкрити.
+         */
+        static RecordReader Unreadable();
+
+        /**
+         * @brief Відкриває файл і зчитує перший блок.
+         * @param fullPath Повний шлях до файлу.
+         * @param bufferBytes Розмір буфера читання.
+         * @param onProgress Зворотний виклик прогресу (може бути порожнім).
+         * @throws std::runtime_error якщо файл не вдалося відкрити.
+         */
+        explicit RecordReader(const std::string& fullPath,
+                              std::size_t bufferBytes = DEFAULT_BUFFER_BYTES,
+                              ReadProgressCallback onProgress = {});
+
+        RecordReader(RecordReader&&) = default;
+        RecordReader& operator=(RecordReader&&) = default;
+
+        bool NextRecord(std::string_view& record) override;
+
+        /**
+         * @brief Оцінка кількості записів за першим блоком і розміром файлу.
+         */
+        [[nodiscard]] std::size_t SizeHint() const override;
+
+        /** @brief Дані, що вже в буфері, але ще не віддані (наприклад, для сигнатури). */
+        [[nodiscard]] std::string_view Peek() const;
+
+        [[nodiscard]] const ReadProgress& Progress() const { return progress_; }
+
+        /** @brief Чи зупинив читання зворотний виклик прогресу. */
+        [[nodiscard]] bool Cancelled() const override { return cancelled_; }
+
+        /** @brief Чи обірвала читання помилка файлу (на відміну від його кінця). */
+        [[nodiscard]] bool Failed() const override { return failed_; }
+    };
+}
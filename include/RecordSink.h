@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "DurableFile.h"
+#include "OutputBuffer.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Приймач записів із буферизацією — протилежність IRecordSource.
+     *
+     * Серіалізатори дописують запис у Buffer() і закривають його EndRecord();
+     * щойно в буфері набирається FlushBytes() байтів, вони віддаються
+     * WriteChunk і буфер очищується. Тож пам'ять обмежена розміром порції
+     * (плюс один запис), хоч би скільки даних пройшло через приймач.
+     */
+    class RecordSink
+    {
+    private:
+        OutputBuffer buffer_;
+        std::size_t flushBytes_;
+        std::uint64_t bytesWritten_ = 0;
+
+    protected:
+        /**
+         * @brief Віддає порцію даних адресату.
+         * @throws std::runtime_error якщо записати не вдалося.
+         */
+        virtual void WriteChunk(std::string_view chunk) = 0;
+
+    public:
+        /// @brief Розмір порції за замовчуванням (1 МіБ).
+        static constexpr std::size_t DEFAULT_FLUSH_BYTES = std::size_t{1} << 20;
+
+        /**
+         * @brief Конструктор.
+         * @param flushBytes Розмір порції; 0 — віддавати кожен запис окремо.
+         */
+        explicit RecordSink(std::size_t flushBytes = DEFAULT_FLUSH_BYTES);
+        virtual ~RecordSink() = default;
+
+        RecordSink(const RecordSink&) = delete;
+        RecordSink& operator=(const RecordSink&) = delete;
+
+        /** @brief Буфер, у кінець якого дописується поточний запис. */
+        [[nodiscard]] OutputBuffer& Buffer() { return buffer_; }
+
+        /** @brief Завершує запис; віддає порцію, якщо буфер заповнився. */
+        void EndRecord()
+        {
+            if (buffer_.Size() >= flushBytes_) Flush();
+        }
+
+        /**
+         * @brief Дописує готові дані; великі блоки йдуть адресату без копіювання в буфер.
+         */
+        void Write(std::string_view data);
+
+        /** @brief Віддає адресату все, що накопичилося в буфері. */
+        void Flush();
+
+        [[nodiscard]] std::size_t FlushBytes() const { return flushBytes_; }
+
+        /** @brief Кількість байтів, уже відданих адресату. */
+        [[nodiscard]] std::uint64_t BytesWritten() const { return bytesWritten_; }
+    };
+
+    /**
+     * @brief Приймач, що пише порції прямо у файл (без власного буфера потоку).
+     * Деструктор не скидає буфер: дані гарантовано на диску лише після Close().
+     */
+    class FileRecordSink : public RecordSink
+    {
+    private:
+        DurableFile file_;
+
+    protected:
+        void WriteChunk(std::string_view chunk) override;
+
+    public:
+        /**
+         * @brief Відкриває (перезаписує) файл.
+         * @throws std::runtime_error якщо файл не вдалося відкрити.
+         */
+        explicit FileRecordSink(const std::string& path,
+                                std::size_t flushBytes = DEFAULT_FLUSH_BYTES);
+
+        /**
+         * @brief Скидає буфер, переносить файл на носій (fsync) і закриває його.
+         * @throws std::runtime_error якщо запис не вдався.
+         */
+        void Close();
+    };
+}
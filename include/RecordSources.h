@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "IRecordSource.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Джерело записів поверх вектора рядків (сумісність із LoadFromFile).
+     */
+    class VectorRecordSource : public IRecordSource
+    {
+    private:
+        const std::vector<std::string>& lines_;
+        std::size_t index_;
+
+    public:
+        /**
+         * @brief Конструктор.
+         * @param lines Рядки; повинні жити довше за джерело.
+         */
+        explicit VectorRecordSource(const std::vector<std::string>& lines);
+
+        bool NextRecord(std::string_view& record) override;
+        [[nodiscard]] std::size_t SizeHint() const override;
+    };
+
+    /**
+     * @brief Діапазон непорожніх рядків у суцільному буфері (без копіювання).
+     * Підтримує range-based for та інтерфейс IRecordSource.
+     */
+    class LineRange : public IRecordSource
+    {
+    private:
+        std::string_view data_;
+        std::size_t cursor_;
+
+    public:
+        /**
+         * @brief Ітератор по рядках; символи '\n' та кінцеві '\r' відкидаються.
+         */
+        class Iterator
+        {
+        private:
+            std::string_view data_;
+            std::size_t pos_;
+            std::string_view line_;
+
+            void Advance();
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+
+            Iterator() : pos_(0) {}
+            Iterator(std::string_view data, std::size_t pos);
+
+            reference operator*() const { return line_; }
+            pointer operator->() const { return &line_; }
+            Iterator& operator++();
+            Iterator operator++(int);
+
+            bool operator==(const Iterator& other) const
+            {
+                return line_.data() == other.line_.data();
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        /**
+         * @brief Конструктор.
+         * @param data Буфер із рядками; повинен жити довше за діапазон.
+         */
+        explicit LineRange(std::string_view data);
+
+        [[nodiscard]] Iterator begin() const;
+        [[nodiscard]] Iterator end() const;
+
+        bool NextRecord(std::string_view& record) override;
+
+        /** @brief Кількість символів нового рядка у буфері (оцінка кількості записів). */
+        [[nodiscard]] std::size_t SizeHint() const override;
+    };
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "Utils.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Числові стовпці складу. Спочатку цілі (std::int32_t), потім дійсні (double).
+     */
+    enum class RosterColumn : std::uint8_t
+    {
+        Age,
+        Games,
+        Goals,
+        Assists,
+        Shots,
+        Tackles,
+        KeyPasses,
+        MatchesPlayed,
+        Saves,
+        CleanSheets,
+        GoalsConceded,
+        PenaltiesSaved,
+        MonthsWithoutClub,
+        Height,
+        Weight,
+        MarketValue,
+        Salary,
+        Rating
+    };
+
+    /// @brief Кількість цілих стовпців (від Age до MonthsWithoutClub).
+    constexpr std::size_t INT_COLUMN_COUNT = 13;
+
+    /// @brief Кількість дійсних стовпців (від Height до Rating).
+    constexpr std::size_t DOUBLE_COLUMN_COUNT = 5;
+
+    /** @brief Чи зберігається стовпець як std::int32_t. */
+    constexpr bool IsIntColumn(RosterColumn column)
+    {
+        return static_cast<std::size_t>(column) < INT_COLUMN_COUNT;
+    }
+
+    /**
+     * @brief Значення всіх стовпців одного гравця; поля, яких гравець не має
+     * (наприклад, сейви польового гравця), дорівнюють нулю.
+     */
+    struct RosterRow
+    {
+        int playerId = 0;
+        Position position = Position::Goalkeeper;
+        /// @brief Індекс альтернативи PlayerVariant (точний тип гравця).
+        std::uint8_t kind = 0;
+        std::array<std::int32_t, INT_COLUMN_COUNT> ints{};
+        std::array<double, DOUBLE_COLUMN_COUNT> doubles{};
+
+        std::int32_t& Int(RosterColumn column);
+        double& Double(RosterColumn column);
+    };
+
+    /**
+     * @brief Підсумок стовпця: кількість, сума, мінімум і максимум.
+     */
+    struct ColumnSummary
+    {
+        std::size_t count = 0;
+        double sum = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+
+        [[nodiscard]] double Mean() const;
+    };
+
+    /**
+     * @brief Стовпцеве (structure-of-arrays) дзеркало числових полів складу.
+     *
+     * Кожен стовпець — суцільний масив, індексований щільним номером слота
+     * гравця в ClubManager, тож агрегати й рейтинги читають пам'ять
+     * послідовно, без переходів за вказівниками на об'єкти гравців.
+     * ClubManager оновлює рядок щоразу, коли змінює або переіндексовує гравця.
+     */
+    class RosterColumns
+    {
+    private:
+        std::vector<int> playerIds_;
+        std::vector<Position> positions_;
+        std::vector<std::uint8_t> kinds_;
+        std::array<std::vector<std::int32_t>, INT_COLUMN_COUNT> ints_;
+        std::array<std::vector<double>, DOUBLE_COLUMN_COUNT> doubles_;
+
+    public:
+        /** @brief Додає рядок у кінець. */
+        void PushBack(const RosterRow& row);
+
+        /** @brief Перезаписує рядок слота. */
+        void Set(std::size_t slot, const RosterRow& row);
+
+        /** @brief Видаляє слот, зсуваючи наступні на один (як ClubManager::EraseSlot). */
+        void Remove(std::size_t slot);
+
+        void Clear();
+        void Reserve(std::size_t count);
+        [[nodiscard]] std::size_t Size() const;
+
+        [[nodiscard]] std::span<const int> PlayerIds() const;
+        [[nodiscard]] std::span<const Position> Positions() const;
+
+        /** @brief Точні типи гравців (індекси альтернатив PlayerVariant). */
+        [[nodiscard]] std::span<const std::uint8_t> Kinds() const;
+
+        /**
+         * @brief Цілий стовпець.
+         * @throws std::invalid_argument якщо стовпець дійсний.
+         */
+        [[nodiscard]] std::span<const std::int32_t> Ints(RosterColumn column) const;
+
+        /**
+         * @brief Дійсний стовпець.
+         * @throws std::invalid_argument якщо стовпець цілий.
+         */
+        [[nodiscard]] std::span<const double> Doubles(RosterColumn column) const;
+
+        /** @brief Значення стовпця для слота (будь-якого типу) як double. */
+        [[nodiscard]] double Value(RosterColumn column, std::size_t slot) const;
+
+        /**
+         * @brief Кількість, сума, мінімум і максимум стовпця одним послідовним проходом.
+         */
+        [[nodiscard]] ColumnSummary Summarize(RosterColumn column) const;
+
+        /**
+         * @brief ID k гравців із найбільшими (або найменшими) значеннями стовпця.
+         * Один послідовний прохід із купою на k елементів; при рівних
+         * значеннях — ID за зростанням.
+         * @param descending True — найбільші значення першими.
+         */
+        [[nodiscard]] std::vector<int> TopK(RosterColumn column, std::size_t k,
+                                            bool descending = true) const;
+    };
+}
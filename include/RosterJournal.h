@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include "DurableFile.h"
+#include "FileManager.h"
+#include "OutputBuffer.h"
+#include "ISnapshotHandler.h"
+#include "Utils.h"
+
+namespace FootballManagement
+{
+    class ClubManager;
+
+    /**
+     * @brief Журнал змін складу (write-ahead log) для збереження за O(зміни).
+     *
+     * Кожна мутація складу дописується в кінець файлу журналу одним рядком
+     * формату "<OP> <довжина> <дані>". Періодично журнал ущільнюється:
+     * повний знімок клубу атомарно записується через тимчасовий файл і
+     * перейменування, після чого журнал очищується. При запуску знімок
+     * завантажується, а журнал програється поверх нього.
+     *
+     * Методи потокобезпечні: фоновий AutoSaver дописує журнал, поки
+     * інтерфейс може ущільнити або відновити його. Порядок блокувань —
+     * спершу журнал, потім склад; негайне журналювання мутацій (склад →
+     * журнал) допустиме лише тоді, коли з журналом працює один потік.
+     */
+    class RosterJournal
+    {
+    private:
+        FileManager fileManager_;
+        std::string snapshotFile_;
+        std::string journalFile_;
+        std::size_t compactionThreshold_;
+        std::size_t entryCount_;
+        DurableFile out_;
+        /// @brief Буфер рядка журналу, який перевикористовується між записами.
+        OutputBuffer line_;
+        /// @brief Останнє відновлення не завантажило знімок: склад у пам'яті неповний.
+        bool recoveryFailed_ = false;
+        /// @brief Рекурсивний: пакет записів під Lock() викликає Append і Compact.
+        mutable std::recursive_mutex mutex_;
+
+        bool OpenForAppend();
+
+        /**
+         * @brief Спільна частина Compact: зберігає знімок і очищує журнал.
+         * @param saveSnapshot Атомарно записує файл знімка.
+         */
+        bool CompactWith(const std::function<bool()>& saveSnapshot);
+
+    public:
+        /// @brief Операція: додано гравця (дані — повний запис).
+        static constexpr std::string_view OP_ADD = "ADD";
+        /// @brief Операція: змінено гравця (дані — повний запис).
+        static constexpr std::string_view OP_UPDATE = "UPDATE";
+        /// @brief Операція: видалено гравця (дані — ID).
+        static constexpr std::string_view OP_REMOVE = "REMOVE";
+        /// @brief Операція: змінено бюджет (дані — нове значення).
+        static constexpr std::string_view OP_BUDGET = "BUDGET";
+
+        /**
+         * @brief Конструктор.
+         * @param fileManager Менеджер файлів (визначає каталог даних).
+         * @param compactionThreshold Кількість записів, після якої журнал ущільнюється.
+         * @param snapshotFile Файл повного знімка складу.
+         * @param journalFile Файл журналу.
+         */
+        explicit RosterJournal(const FileManager& fileManager,
+                               std::size_t compactionThreshold = 1000,
+                               const std::string& snapshotFile =
+                                   PLAYERS_DATA_FILE,
+                               const std::string& journalFile =
+                                   PLAYERS_JOURNAL_FILE);
+
+        RosterJournal(const RosterJournal&) = delete;
+        RosterJournal& operator=(const RosterJournal&) = delete;
+
+        /**
+         * @brief Дописує операцію в кінець журналу.
+         * @param op Код операції (OP_ADD, OP_UPDATE, ...).
+         * @param payload Дані операції (без символів нового рядка).
+         * @param sync Одразу скинути журнал на диск (fsync). Пакет записів
+         * передає false і завершується одним Sync() — груповий запис.
+         * Після невдалого Recover нічого не дописує, як і Compact.
+         * @return bool Результат запису.
+         */
+        bool Append(std::string_view op, std::string_view payload,
+                    bool sync = true);
+
+        /**
+         * @brief Скидає на диск записи, дописані з sync = false.
+         * @return bool Результат операції.
+         */
+        bool Sync();
+
+        /**
+         * @brief Блокує журнал, щоб серія записів не перемежовувалася з
+         * ущільненням з іншого потоку.
+         */
+        [[nodiscard]] std::unique_lock<std::recursive_mutex> Lock() const;
+
+        /** @brief Кількість записів у журналі з моменту останнього ущільнення. */
+        [[nodiscard]] std::size_t GetEntryCount() const;
+
+        /** @brief Чи настав час ущільнити журнал. */
+        [[nodiscard]] bool NeedsCompaction() const;
+
+        /**
+         * @brief Атомарно записує знімок (у форматі FileManager) і очищує журнал.
+         * Після невдалого Recover нічого не робить, доки відновлення не вдасться.
+         * @param snapshot Об'єкт, що серіалізує повний стан (ClubManager).
+         * @return bool Результат операції.
+         */
+        bool Compact(const ISnapshotHandler& snapshot);
+
+        /**
+         * @brief Ущільнює журнал у вже знятий знімок складу.
+         * AutoSaver передає знімок, з якого щойно дописав зміни, тож у файл
+         * не потрапляють мутації, що надійшли після них.
+         * @param roster Знімок складу.
+         * @return bool Результат операції.
+         */
+        bool Compact(const RosterSnapshot& roster);
+
+        /**
+         * @brief Відновлює стан клубу: знімок + програвання журналу.
+         * Якщо журнал містив записи, після відновлення виконується ущільнення.
+         * Якщо знімок не завантажено, відновлення переривається без
+         * програвання й ущільнення, щоб не перезаписати знімок неповним складом.
+         * @param clubManager Менеджер клубу, який потрібно відновити.
+         * @throws std::runtime_error якщо знімок не завантажено або журнал не дочитано.
+         */
+        void Recover(ClubManager& clubManager);
+
+        /**
+         * @brief Розбирає рядок журналу.
+         * @param entry Рядок "<OP> <довжина> <дані>".
+         * @param op Вихідний код операції.
+         * @param payload Вихідні дані.
+         * @return bool False, якщо рядок пошкоджений (наприклад, обірваний запис).
+         */
+        static bool ParseEntry(std::string_view entry, std::string_view& op,
+                               std::string_view& payload);
+    };
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Player.h"
+#include "PlayerStatus.h"
+#include "Utils.h"
+
+namespace FootballManagement
+{
+    class ClubManager;
+
+    /**
+     * @brief Ключ сортування результатів запиту.
+     */
+    enum class QueryOrder
+    {
+        None,
+        Id,
+        Name,
+        Age,
+        MarketValue,
+        Rating
+    };
+
+    /**
+     * @brief Умови запиту до складу; незадані поля не обмежують вибірку.
+     */
+    struct QueryCriteria
+    {
+        std::optional<int> minAge;
+        std::optional<int> maxAge;
+        std::optional<Position> position;
+        std::optional<std::string> nationality;
+        std::optional<double> minValue;
+        std::optional<double> maxValue;
+        std::optional<double> minSalary;
+        std::optional<double> maxSalary;
+        /// @brief Умови статусу, об'єднані через АБО (порожній список — збігів немає).
+        std::optional<std::vector<StatusFilter>> status;
+        std::optional<std::string> nameContains;
+        QueryOrder order = QueryOrder::None;
+        bool descending = false;
+        /// @brief Максимальна кількість результатів (0 — без обмеження).
+        std::size_t limit = 0;
+    };
+
+    /**
+     * @brief Компонований запит до складу клубу.
+     *
+     * Умови лише накопичуються і виконуються ліниво одним проходом під час
+     * виклику Ids, Count, ForEach або Select. Кандидати беруться з наявного
+     * індексу (імен, діапазонів вартості / віку / зарплати, бітових площин
+     * статусу або кешованого рейтингу), решта умов перевіряється для кожного
+     * кандидата без проміжних векторів.
+     * Результати — ID або проєкції, без копіювання std::shared_ptr.
+     * Повторний виклик Where* замінює попередню умову, крім WhereStatus і
+     * WhereInjured, які поєднуються через І.
+     * Запит посилається на ClubManager і дійсний, доки той не змінено.
+     */
+    class RosterQuery
+    {
+    private:
+        const ClubManager& club_;
+        QueryCriteria criteria_;
+
+        void Run(const std::function<bool(const Player&)>& visit) const;
+
+    public:
+        explicit RosterQuery(const ClubManager& club);
+
+        /** @brief Вік у межах [minAge, maxAge]. */
+        RosterQuery& WhereAge(int minAge, int maxAge);
+
+        /** @brief Ігрова позиція. */
+        RosterQuery& WherePosition(Position position);
+
+        /** @brief Громадянство (без урахування регістру). */
+        RosterQuery& WhereNationality(const std::string& nationality);
+
+        /** @brief Ринкова вартість у межах [minValue, maxValue]. */
+        RosterQuery& WhereValue(double minValue, double maxValue);
+
+        /** @brief Зарплата за контрактом у межах [minSalary, maxSalary] (лише гравці з контрактом). */
+        RosterQuery& WhereSalary(double minSalary, double maxSalary);
+
+        /** @brief Травмований (true) чи здоровий (false) гравець. */
+        RosterQuery& WhereInjured(bool injured);
+
+        /**
+         * @brief Прапорці статусу; кілька викликів поєднуються через І.
+         * @param required Прапорці, які мають бути встановлені всі.
+         * @param excluded Прапорці, жоден з яких не має бути встановлений.
+         */
+        RosterQuery& WhereStatus(PlayerStatus required,
+                                 PlayerStatus excluded = PlayerStatus::None);
+
+        /** @brief Частина локалізованої назви статусу (як у FilterByStatus). */
+        RosterQuery& WhereStatus(const std::string& statusText);
+
+        /** @brief Частина імені (без урахування регістру, через індекс імен). */
+        RosterQuery& WhereNameContains(const std::string& nameQuery);
+
+        /**
+         * @brief Порядок результатів; при рівних ключах — ID за зростанням
+         * (для рейтингу за спаданням — як у RankingView).
+         */
+        RosterQuery& OrderBy(QueryOrder order, bool descending = false);
+
+        /** @brief Максимальна кількість результатів (0 — без обмеження). */
+        RosterQuery& Limit(std::size_t limit);
+
+        /** @brief Накопичені умови. */
+        [[nodiscard]] const QueryCriteria& Criteria() const;
+
+        /** @brief ID гравців, що задовольняють запит. */
+        [[nodiscard]] std::vector<int> Ids() const;
+
+        /** @brief Кількість результатів (з урахуванням Limit). */
+        [[nodiscard]] std::size_t Count() const;
+
+        /**
+         * @brief Викликає visit для кожного результату.
+         * @param visit Функція від const Player&.
+         */
+        void ForEach(const std::function<void(const Player&)>& visit) const;
+
+        /**
+         * @brief Проєкція результатів: project викликається для кожного гравця.
+         * @param project Функція від const Player&, що повертає потрібні поля.
+         * @return Вектор проєкцій у порядку запиту.
+         */
+        template <typename Projection>
+        auto Select(Projection&& project) const
+        {
+            using Row = std::decay_t<std::invoke_result_t<Projection&,
+                                                          const Player&>>;
+            std::vector<Row> rows;
+            Run([&rows, &project](const Player& player)
+            {
+                rows.push_back(project(player));
+                return true;
+            });
+            return rows;
+        }
+    };
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "PersistentVector.h"
+#include "Player.h"
+#include "RecordSink.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Зведення складу для звітів.
+     */
+    struct SquadSummary
+    {
+        std::size_t playerCount = 0;
+        std::size_t injuredCount = 0;
+        double averageAge = 0.0;
+        double totalMarketValue = 0.0;
+        /// @brief Сума CalculateValue() по складу.
+        double totalValue = 0.0;
+    };
+
+    /**
+     * @brief Незмінна версія складу на момент ClubManager::Snapshot().
+     *
+     * Знімок ділить структуру з робочим складом (PersistentVector), тож
+     * створюється за O(1); гравці, яких менеджер змінює після знімка,
+     * спершу копіюються, тому знімок їх змін не бачить. Знімок можна
+     * читати з будь-якого потоку без блокувань, поки менеджер продовжує
+     * приймати зміни. Поки існує хоч один знімок, перший запис у кожного
+     * знятого гравця створює його копію.
+     */
+    class RosterSnapshot
+    {
+    private:
+        PersistentVector<std::shared_ptr<const Player>> players_;
+        std::string clubName_;
+        double transferBudget_;
+        int nextId_;
+        std::uint64_t version_;
+        /// @brief Поки живий, менеджер копіює гравців перед зміною.
+        std::shared_ptr<const void> lease_;
+
+    public:
+        RosterSnapshot(PersistentVector<std::shared_ptr<const Player>> players,
+                       std::string clubName, double transferBudget, int nextId,
+                       std::uint64_t version, std::shared_ptr<const void> lease);
+
+        /** @brief Порядковий номер знімка в межах менеджера (від 1). */
+        [[nodiscard]] std::uint64_t Version() const;
+
+        [[nodiscard]] std::size_t Size() const;
+        [[nodiscard]] const std::string& GetClubName() const;
+        [[nodiscard]] double GetTransferBudget() const;
+
+        /** @brief Наступний ID менеджера на момент знімка (більший за всі ID у ньому). */
+        [[nodiscard]] int GetNextId() const;
+
+        /**
+         * @brief Гравець у слоті index (порядок складу на момент знімка).
+         * @throws std::out_of_range якщо index >= Size().
+         */
+        [[nodiscard]] const Player& At(std::size_t index) const;
+
+        /**
+         * @brief Гравець за ID (лінійний пошук) або nullptr.
+         */
+        [[nodiscard]] std::shared_ptr<const Player> FindById(int playerId) const;
+
+        /**
+         * @brief Обходить гравців у порядку складу.
+         * @param visit Викликається з const Player&.
+         */
+        template <typename Visit>
+        void ForEach(Visit&& visit) const
+        {
+            players_.ForEach([&visit](const std::shared_ptr<const Player>& player)
+            {
+                visit(*player);
+            });
+        }
+
+        /** @brief Кількість, травмовані, середній вік і вартість складу. */
+        [[nodiscard]] SquadSummary Summarize() const;
+
+        /** @brief Виводить повний список гравців знімка в консоль. */
+        void ViewAllPlayers() const;
+
+        /**
+         * @brief Потоково пише текстовий знімок: заголовок клубу і по
+         * запису на гравця (формат ClubManager::AppendTo).
+         */
+        void WriteTo(RecordSink& sink) const;
+
+        /** @brief Бінарний знімок у форматі ClubManager::DeserializeBinary. */
+        [[nodiscard]] std::string SerializeBinary() const;
+    };
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Статистика арени: скільки пам'яті взято в системи і скільки вузлів зайнято.
+     */
+    struct SlabStats
+    {
+        std::size_t nodeSize = 0;
+        std::size_t slabCount = 0;
+        std::size_t reservedBytes = 0;
+        std::size_t liveNodes = 0;
+    };
+
+    /**
+     * @brief Арена вузлів однакового розміру, що виділяє пам'ять великими плитами.
+     *
+     * Розмір вузла задає перше виділення. Кожна наступна плита вдвічі
+     * більша за попередню (до MAX_SLAB_NODES вузлів), тож мільйон об'єктів
+     * займає півтора десятка виділень замість мільйона. Звільнені вузли
+     * потрапляють у список вільних і використовуються повторно; плити
+     * повертаються системі лише з завершенням процесу.
+     *
+     * Кожен потік тримає власний запас вузлів (до 2 * CACHE_BATCH) і бере
+     * спільний м'ютекс лише раз на CACHE_BATCH виділень чи звільнень, тож
+     * паралельне завантаження не впирається в одне блокування. Арени
+     * існують лише через ForType і живуть до кінця процесу: запас потоку
+     * повертається в арену, коли потік завершується.
+     */
+    class SlabArena
+    {
+    private:
+        static constexpr std::size_t FIRST_SLAB_NODES = 64;
+        static constexpr std::size_t MAX_SLAB_NODES = std::size_t{1} << 18;
+        /// @brief Скільки вузлів потік бере з арени чи повертає в неї за раз.
+        static constexpr std::size_t CACHE_BATCH = 32;
+
+        struct FreeNode
+        {
+            FreeNode* next;
+        };
+
+        /** @brief Запас вузлів однієї арени в одному потоці. */
+        struct ThreadCache
+        {
+            SlabArena* arena;
+            FreeNode* head;
+            std::size_t count;
+        };
+
+        /// @brief Розмір вузла; 0, доки його не зафіксувало перше виділення.
+        std::atomic<std::size_t> nodeSize_;
+        std::size_t alignment_;
+        std::size_t nextSlabNodes_;
+        FreeNode* freeList_;
+        std::byte* cursor_;
+        std::byte* slabEnd_;
+        std::vector<void*> slabs_;
+        std::size_t reservedBytes_;
+        std::atomic<std::size_t> liveNodes_;
+        mutable std::mutex mutex_;
+
+        SlabArena();
+
+        /** @brief Чи вміщує вузол об'єкт такого розміру й вирівнювання. */
+        [[nodiscard]] bool FitsNode(std::size_t nodeSize, std::size_t size,
+                                    std::size_t alignment) const;
+
+        /** @brief Виділяє плиту щонайменше на minNodes вузлів. */
+        void Grow(std::size_t minNodes);
+
+        /** @brief Вузол зі спільного списку чи плити; викликається під м'ютексом. */
+        FreeNode* TakeLocked();
+
+        /**
+         * @brief Запас поточного потоку для цієї арени.
+         * @return ThreadCache* Запас або nullptr, якщо потік уже завершується
+         * чи вичерпано місця під запаси (тоді працює спільний шлях).
+         */
+        ThreadCache* LocalCache() noexcept;
+
+        /** @brief Поповнює порожній запас потоку на CACHE_BATCH вузлів. */
+        void Refill(ThreadCache& cache);
+
+        /** @brief Повертає в арену всі вузли запасу, крім keep. */
+        void Drain(ThreadCache& cache, std::size_t keep) noexcept;
+
+    public:
+        SlabArena(const SlabArena&) = delete;
+        SlabArena& operator=(const SlabArena&) = delete;
+
+        /**
+         * @brief Вузол з арени.
+         * @param size Розмір об'єкта; перше виділення фіксує розмір вузла.
+         * @param alignment Вирівнювання об'єкта.
+         * @return void* Вузол або nullptr, якщо об'єкт не вміщується у вузол.
+         */
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment);
+
+        /** @brief Чи був би об'єкт такого розміру виділений з арени. */
+        [[nodiscard]] bool Fits(std::size_t size, std::size_t alignment) const;
+
+        /** @brief Повертає вузол у запас потоку (надлишок — у спільний список). */
+        void Deallocate(void* node) noexcept;
+
+        /**
+         * @brief Гарантує, що наступні count виділень не звернуться до системи.
+         * Не діє, доки розмір вузла не зафіксовано першим виділенням.
+         * @param count Кількість вузлів.
+         */
+        void Reserve(std::size_t count);
+
+        [[nodiscard]] SlabStats Stats() const;
+
+        /**
+         * @brief Спільна арена типу Tag.
+         * Арена навмисно не знищується, щоб об'єкти, які переживуть
+         * статичні змінні, могли безпечно повернути свої вузли.
+         */
+        template <typename Tag>
+        static SlabArena& ForType()
+        {
+            static SlabArena* arena = new SlabArena();
+            return *arena;
+        }
+    };
+
+    /**
+     * @brief Алокатор стандартної бібліотеки поверх арени типу Tag.
+     *
+     * Призначений для std::allocate_shared: об'єкт разом із блоком
+     * керування займає один вузол арени свого конкретного типу (Tag
+     * зберігається при rebind). Масиви й об'єкти, що не вміщуються у
+     * вузол, виділяються звичайним operator new.
+     */
+    template <typename T, typename Tag = T>
+    class SlabAllocator
+    {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = SlabAllocator<U, Tag>;
+        };
+
+        SlabAllocator() noexcept = default;
+
+        template <typename U>
+        SlabAllocator(const SlabAllocator<U, Tag>&) noexcept
+        {
+        }
+
+        [[nodiscard]] static SlabArena& Arena()
+        {
+            return SlabArena::ForType<Tag>();
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            if (n == 1)
+            {
+                if (void* node = Arena().Allocate(sizeof(T), alignof(T)))
+                    return static_cast<T*>(node);
+            }
+            return static_cast<T*>(::operator new(
+                n * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            if (n == 1 && Arena().Fits(sizeof(T), alignof(T)))
+                Arena().Deallocate(p);
+            else
+                ::operator delete(p, std::align_val_t{alignof(T)});
+        }
+
+        template <typename U>
+        bool operator==(const SlabAllocator<U, Tag>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    /**
+     * @brief Створює об'єкт в арені його типу (аналог std::make_shared).
+     */
+    template <typename T, typename... Args>
+    std::shared_ptr<T> MakePooled(Args&&... args)
+    {
+        return std::allocate_shared<T>(SlabAllocator<T>{},
+                                       std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Статистика арени, у якій MakePooled створює об'єкти типу T.
+     */
+    template <typename T>
+    SlabStats PoolStats()
+    {
+        return SlabArena::ForType<T>().Stats();
+    }
+}
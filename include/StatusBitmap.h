@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "PlayerStatus.h"
+
+namespace FootballManagement
+{
+    /**
+     * @brief Бітові площини статусів складу: для кожного прапорця PlayerStatus
+     * окремий бітовий вектор, де біт i відповідає гравцю в слоті i.
+     *
+     * Фільтр обчислюється послівно (по 64 гравці) як АБО умов, кожна з яких —
+     * І відповідних площин (та їх заперечень для виключених прапорців),
+     * без звернень до об'єктів гравців.
+     */
+    class StatusBitmap
+    {
+    private:
+        std::vector<PlayerStatus> flags_;
+        std::array<std::vector<std::uint64_t>, PLAYER_STATUS_FLAG_COUNT> planes_;
+
+        void WriteBits(std::size_t slot, PlayerStatus flags);
+
+        /**
+         * @brief Викликає visit(word, bits) для кожного 64-бітного слова збігів.
+         * Обхід зупиняється, щойно visit поверне false.
+         */
+        template <typename Visitor>
+        void ForEachWord(const std::vector<StatusFilter>& anyOf,
+                         Visitor&& visit) const;
+
+    public:
+        /** @brief Додає слот у кінець. */
+        void PushBack(PlayerStatus flags);
+
+        /** @brief Оновлює прапорці слота (змінюються лише біти, що відрізняються). */
+        void Set(std::size_t slot, PlayerStatus flags);
+
+        /** @brief Прапорці слота. */
+        [[nodiscard]] PlayerStatus Get(std::size_t slot) const;
+
+        /**
+         * @brief Видаляє слот, зсуваючи наступні на один (як ClubManager::EraseSlot).
+         */
+        void Remove(std::size_t slot);
+
+        void Clear();
+        void Reserve(std::size_t count);
+        [[nodiscard]] std::size_t Size() const;
+
+        /**
+         * @brief Слоти, що задовольняють хоча б один фільтр, за зростанням.
+         * @param anyOf Фільтри, об'єднані через АБО.
+         */
+        [[nodiscard]] std::vector<std::size_t> Select(
+            const std::vector<StatusFilter>& anyOf) const;
+
+        /**
+         * @brief Викликає visit(slot) для слотів, що задовольняють хоча б один
+         * фільтр, за зростанням, без проміжного вектора.
+         * @param visit Повертає false, щоб зупинити обхід.
+         */
+        void ForEachSlot(const std::vector<StatusFilter>& anyOf,
+                         const std::function<bool(std::size_t)>& visit) const;
+
+        /** @brief Кількість слотів, що задовольняють хоча б один фільтр. */
+        [[nodiscard]] std::size_t Count(
+            const std::vector<StatusFilter>& anyOf) const;
+    };
+}
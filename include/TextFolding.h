@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Приводить текст UTF-8 до нижнього регістру для порівняння без урахування регістру.
+     *
+     * Підтримуються латиниця (ASCII, Latin-1, Latin Extended-A), грецька та
+     * кирилиця (включно з українськими Є, І, Ї, Ґ). Усі ці символи мають
+     * двобайтові пари великих і малих літер, тому довжина рядка не змінюється.
+     * Фрагменти з чистого ASCII обробляються векторно (SSE2 або по 8 байтів),
+     * решта — через попередньо обчислену таблицю кодових точок.
+     * Некоректні послідовності UTF-8 копіюються без змін.
+     *
+     * @param text Вхідний текст.
+     * @return std::string Текст у нижньому регістрі.
+     */
+    std::string FoldCase(std::string_view text);
+
+    /**
+     * @brief Те саме, що FoldCase, але змінює рядок на місці.
+     * @param text Рядок, який потрібно привести до нижнього регістру.
+     */
+    void FoldCaseInPlace(std::string& text);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Пул робочих потоків фіксованого розміру зі спільною чергою задач.
+     *
+     * Задачі виконуються в порядку надходження будь-яким вільним потоком.
+     * Деструктор дочікується виконання всіх поставлених задач.
+     */
+    class ThreadPool
+    {
+    private:
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable available_;
+        bool stopping_ = false;
+
+        /** @brief Цикл робочого потоку: бере задачі з черги до зупинки пулу. */
+        void WorkerLoop();
+
+        /** @brief Ставить задачу в чергу й будить один потік. */
+        void Enqueue(std::function<void()> task);
+
+    public:
+        /**
+         * @brief Запускає робочі потоки.
+         * @param threadCount Кількість потоків (0 — за кількістю ядер процесора).
+         */
+        explicit ThreadPool(std::size_t threadCount = 0);
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Виконує залишок черги й зупиняє потоки. */
+        ~ThreadPool() noexcept;
+
+        /** @brief Кількість робочих потоків. */
+        [[nodiscard]] std::size_t ThreadCount() const;
+
+        /**
+         * @brief Ставить задачу в чергу.
+         * @param task Функція без аргументів.
+         * @return std::future Результат задачі; виняток задачі передається через get().
+         */
+        template <typename Task>
+        auto Submit(Task&& task) -> std::future<std::invoke_result_t<std::decay_t<Task>>>
+        {
+            using Result = std::invoke_result_t<std::decay_t<Task>>;
+            // std::function вимагає копійованої функції, тож packaged_task
+            // тримається через shared_ptr.
+            auto packaged = std::make_shared<std::packaged_task<Result()>>(
+                std::forward<Task>(task));
+            std::future<Result> result = packaged->get_future();
+            Enqueue([packaged] { (*packaged)(); });
+            return result;
+        }
+
+        /**
+         * @brief Спільний пул процесу (створюється при першому зверненні).
+         */
+        static ThreadPool& Shared();
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "Utils.h"
 #include "IFileHandler.h"
 
@@ -103,11 +104,22 @@ namespace FootballManagement
       */
         std::string Serialize() const override;
 
+        /**
+         * @brief Дописує рядок "username:password:role" у буфер.
+         */
+        void AppendTo(OutputBuffer& out) const override;
+
         /**
        * @brief Десеріалізує користувача з рядка "username:password:role".
        * @param data Вхідний рядок.
        * @details У разі помилки встановлюється гостьовий профіль.
        */
         void Deserialize(const std::string& data) override;
+
+        /**
+         * @brief Десеріалізує користувача безпосередньо з виду на рядок (без копіювання запису).
+         * @param data Запис "username:password:role".
+         */
+        void DeserializeRecord(std::string_view data);
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace FootballManagement
@@ -10,6 +11,20 @@ namespace FootballManagement
     /// @brief Ім'я файлу для збереження даних гравців.
     const std::string PLAYERS_DATA_FILE = "players.json";
 
+    /// @brief Ключ запису, що містить тип гравця.
+    const std::string PLAYER_TYPE_KEY = "type";
+
+    /// @brief Теги типів гравців у збережених записах.
+    const std::string GOALKEEPER_TYPE_TAG = "Goalkeeper";
+    const std::string FREE_AGENT_TYPE_TAG = "FreeAgent";
+    const std::string CONTRACTED_PLAYER_TYPE_TAG = "ContractedPlayer";
+
+    /// @brief Перший ID, який видається гравцям клубу.
+    constexpr int FIRST_PLAYER_ID = 1001;
+
+    /// @brief Ім'я файлу журналу змін складу.
+    const std::string PLAYERS_JOURNAL_FILE = "players.journal";
+
     /// @brief Логін адміністратора за замовчуванням.
     const std::string DEFAULT_ADMIN_LOGIN = "admin";
 
@@ -37,6 +52,25 @@ namespace FootballManagement
         Forward
     };
 
+    /**
+     * @brief Формат файлу знімка складу.
+     */
+    enum class SnapshotFormat
+    {
+        Text,
+        Binary
+    };
+
+    /**
+     * @brief Теги типів гравців у бінарному знімку складу.
+     */
+    enum class PlayerRecordTag : std::uint8_t
+    {
+        Goalkeeper = 1,
+        FreeAgent = 2,
+        ContractedPlayer = 3
+    };
+
     /**
      * @brief Представляє запис про травму гравця.
      */
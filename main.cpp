@@ -4,9 +4,11 @@
 #include <vector>
 
 #include "include/AuthManager.h"
+#include "include/AutoSaver.h"
 #include "include/ClubManager.h"
 #include "include/FileManager.h"
 #include "include/Menu.h"
+#include "include/RosterJournal.h"
 #include "include/Utils.h"
 
 using namespace FootballManagement;
@@ -15,14 +17,15 @@ using namespace FootballManagement;
  * @brief Завантажує користувачів і гравців із файлів.
  * @param fm Об’єкт класу FileManager.
  * @param cm Менеджер клубу.
+ * @return bool False, якщо гравців не завантажено (склад не можна зберігати).
  */
-void initializeDataLoad(FileManager& fm, ClubManager& cm)
+bool initializeDataLoad(FileManager& fm, ClubManager& cm)
 {
     try
     {
-        std::vector<std::string> usrLines = fm.LoadFromFile(USERS_FILE_NAME);
+        RecordReader usrRecords = fm.ReadRecords(USERS_FILE_NAME);
 
-        AuthManager::GetInstance().DeserializeAllUsers(usrLines);
+        AuthManager::GetInstance().DeserializeAllUsers(usrRecords);
 
         if (AuthManager::GetInstance().GetCurrentUser() == nullptr ||
             !AuthManager::GetInstance().GetCurrentUser()->IsAdmin())
@@ -40,30 +43,50 @@ void initializeDataLoad(FileManager& fm, ClubManager& cm)
 
     try
     {
-        std::vector<std::string> playerLines = fm.LoadFromFile(
-            PLAYERS_DATA_FILE);
-        cm.DeserializeAllPlayers(playerLines);
+        if (const auto journal = cm.GetJournal())
+        {
+            journal->Recover(cm);
+        }
+        else if (!fm.LoadSnapshot(PLAYERS_DATA_FILE, cm))
+        {
+            return false;
+        }
         std::cout << "[ІНФО] Завантажено гравців.\n";
+        return true;
     }
     catch (const std::exception& e)
     {
         std::cout << "[ПОМИЛКА] Неможливо завантажити гравців: " << e.what() <<
             std::endl;
     }
+    return false;
 }
 
 /**
  * @brief Зберігає користувачів і гравців у файли.
  * @param fm Об’єкт класу FileManager.
  * @param cm Менеджер клубу.
+ * @param savePlayers Чи зберігати склад (false, якщо його не вдалося завантажити).
  */
-void initializeDataSave(FileManager& fm, ClubManager& cm)
+void initializeDataSave(FileManager& fm, ClubManager& cm, bool savePlayers)
 {
     try
     {
         fm.SaveToFile(USERS_FILE_NAME, AuthManager::GetInstance());
-        fm.SaveToFile(PLAYERS_DATA_FILE, cm);
-        std::cout << "[ІНФО] Дані успішно збережено.\n";
+        if (!savePlayers)
+        {
+            std::cout << "[ПОПЕРЕДЖЕННЯ] Склад не завантажено — файл гравців "
+                "не перезаписується.\n";
+            return;
+        }
+
+        bool saved = false;
+        if (const auto journal = cm.GetJournal())
+            saved = journal->Compact(cm);
+        else
+            saved = fm.SaveSnapshot(PLAYERS_DATA_FILE, cm);
+        if (saved)
+            std::cout << "[ІНФО] Дані успішно збережено.\n";
     }
     catch (const std::exception& e)
     {
@@ -80,15 +103,26 @@ int main()
     try
     {
         FileManager fileManager;
+        // Холодний старт: знімок складу розбирається на всіх ядрах.
+        fileManager.SetParallelLoad(true);
         auto clubManager = std::make_shared<ClubManager>(
             "Динамо Київ", 50000000.0);
+        clubManager->AttachJournal(
+            std::make_shared<RosterJournal>(fileManager));
+
+        const bool playersLoaded = initializeDataLoad(fileManager, *clubManager);
 
-        initializeDataLoad(fileManager, *clubManager);
+        // Зміни складу зберігаються у фоні, не зупиняючи меню. Неповний
+        // склад після невдалого завантаження у журнал не потрапляє.
+        std::shared_ptr<AutoSaver> autoSaver;
+        if (playersLoaded)
+            autoSaver = std::make_shared<AutoSaver>(*clubManager);
 
-        Menu mainMenu(clubManager);
+        Menu mainMenu(clubManager, autoSaver);
         mainMenu.Run();
 
-        initializeDataLoad(fileManager, *clubManager);
+        if (autoSaver) autoSaver->Stop();
+        initializeDataSave(fileManager, *clubManager, playersLoaded);
     }
     catch (const std::exception& e)
     {
@@ -1,4 +1,5 @@
 #include "../include/AuthManager.h"
+#include "../include/RecordSources.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
@@ -99,7 +100,6 @@ namespace FootballManagement
         if (userName == currentUser_->GetUserName())
         {
             std::cout <<
-                std::cout <<
                 "[ПОМИЛКА] Ви не можете видалити свій активний обліковий запис."
                 << std::endl;
             return false;
@@ -109,7 +109,7 @@ namespace FootballManagement
 
         registeredUsers_.erase(userName);
 
-        if (registeredUsers_.size() < before)
+        if (registeredUsers_.size() < initialSize)
         {
             std::cout << "[УСПІХ] Користувача '" << userName << "' видалено." <<
                 std::endl;
@@ -174,16 +174,34 @@ namespace FootballManagement
 
     std::string AuthManager::Serialize() const
     {
-        std::stringstream ss;
+        OutputBuffer out;
+        AppendTo(out);
+        return out.Take();
+    }
+
+    void AuthManager::AppendTo(OutputBuffer& out) const
+    {
         bool first = true;
         for (const auto& [_, user] : registeredUsers_)
         {
             if (!first)
-                ss << "\n";
-            ss << user->Serialize();
+                out.Append('\n');
+            user->AppendTo(out);
+            first = false;
+        }
+    }
+
+    void AuthManager::WriteTo(RecordSink& sink) const
+    {
+        bool first = true;
+        for (const auto& [_, user] : registeredUsers_)
+        {
+            if (!first)
+                sink.Buffer().Append('\n');
+            user->AppendTo(sink.Buffer());
+            sink.EndRecord();
             first = false;
         }
-        return ss.str();
     }
 
     void AuthManager::Deserialize(const std::string& data)
@@ -201,18 +219,23 @@ namespace FootballManagement
 
     void AuthManager::DeserializeAllUsers(
         const std::vector<std::string>& userDatas)
+    {
+        VectorRecordSource records(userDatas);
+        DeserializeAllUsers(records);
+    }
+
+    void AuthManager::DeserializeAllUsers(IRecordSource& records)
     {
         registeredUsers_.clear();
         int count = 0;
 
-        for (const auto& data : userDatas)
+        std::string_view data;
+        while (records.NextRecord(data))
         {
-            if (data.empty()) continue;
-
             try
             {
                 auto tempUser = std::make_shared<User>();
-                tempUser->Deserialize(data);
+                tempUser->DeserializeRecord(data);
 
                 if (!tempUser->GetUserName().empty())
                 {
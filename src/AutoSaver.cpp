@@ -0,0 +1,199 @@
+#include "../include/AutoSaver.h"
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+namespace FootballManagement
+{
+    AutoSaver::AutoSaver(ClubManager& club, std::chrono::milliseconds interval) :
+        club_(club), journal_(club.GetJournal()), interval_(interval)
+    {
+        if (!journal_)
+            throw std::invalid_argument(
+                "Автозбереження потребує підключеного журналу змін.");
+        if (interval_.count() <= 0)
+            throw std::invalid_argument(
+                "Інтервал автозбереження повинен бути додатним.");
+
+        club_.SetDeferredJournaling(true);
+        worker_ = std::thread(&AutoSaver::Run, this);
+    }
+
+    AutoSaver::~AutoSaver()
+    {
+        try
+        {
+            Stop();
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Автозбереження не завершилося: " << e.what()
+                << std::endl;
+        }
+    }
+
+    void AutoSaver::Run()
+    {
+        std::unique_lock lock(mutex_);
+        while (!stopping_)
+        {
+            wake_.wait_for(lock, interval_, [this]
+            {
+                return stopping_ || requested_ > completed_;
+            });
+            if (stopping_) break;
+
+            const std::uint64_t target = requested_;
+            lock.unlock();
+            SaveChanges();
+            lock.lock();
+            completed_ = target;
+            saved_.notify_all();
+        }
+    }
+
+    void AutoSaver::SaveChanges()
+    {
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+
+        std::size_t records = 0;
+        double pauseSeconds = 0.0;
+        bool ok = true;
+        try
+        {
+            // Забір змін і запис — під блокуванням журналу: ущільнення з
+            // іншого потоку не може вклинитися і пізніше затерти новіший
+            // знімок старішими записами.
+            const auto journalLock = journal_->Lock();
+
+            const RosterChanges changes = club_.TakeChanges();
+            pauseSeconds = changes.lockSeconds;
+
+            bool written = true;
+            try
+            {
+                if (!changes.playerIds.empty())
+                {
+                    // Знімок шукає за ID лінійно, тож змінені знаходяться одним обходом.
+                    std::unordered_set<int> pending(changes.playerIds.begin(),
+                                                    changes.playerIds.end());
+                    changes.snapshot.ForEach([&](const Player& player)
+                    {
+                        if (pending.erase(player.GetPlayerId()) == 0) return;
+                        record_.Clear();
+                        player.AppendTo(record_);
+                        written = journal_->Append(RosterJournal::OP_UPDATE,
+                                                   record_.View(), false) && written;
+                        ++records;
+                    });
+
+                    // Решти у знімку немає — їх видалено.
+                    for (const int playerId : changes.playerIds)
+                    {
+                        if (!pending.contains(playerId)) continue;
+                        written = journal_->Append(RosterJournal::OP_REMOVE,
+                                                   std::to_string(playerId),
+                                                   false) && written;
+                        ++records;
+                    }
+                }
+
+                if (changes.budgetChanged)
+                {
+                    record_.Clear();
+                    record_.AppendDouble(changes.snapshot.GetTransferBudget());
+                    written = journal_->Append(RosterJournal::OP_BUDGET,
+                                               record_.View(), false) && written;
+                    ++records;
+                }
+
+                // Груповий запис: один fsync на прохід замість одного на зміну.
+                if (records > 0) written = journal_->Sync() && written;
+            }
+            catch (...)
+            {
+                club_.RequeueChanges(changes.playerIds, changes.budgetChanged);
+                throw;
+            }
+
+            // Незаписані зміни повертаються до набору змінених, щоб наступний
+            // прохід записав їх знову, а не втратив (повторний запис стану
+            // гравця нешкідливий: програвання бере останній).
+            if (!written)
+                club_.RequeueChanges(changes.playerIds, changes.budgetChanged);
+            ok = written;
+
+            // Ущільнення — з того самого знімка, з якого дописано зміни:
+            // пізніші мутації лишаються в наборі змінених до наступного проходу.
+            if (journal_->NeedsCompaction())
+                ok = journal_->Compact(changes.snapshot) && ok;
+        }
+        catch (const std::exception& e)
+        {
+            ok = false;
+            std::cout << "[ПОМИЛКА] Автозбереження не вдалося: " << e.what() <<
+                std::endl;
+        }
+
+        const double seconds = std::chrono::duration<double>(
+            Clock::now() - start).count();
+
+        const std::lock_guard lock(mutex_);
+        stats_.maxPauseSeconds = std::max(stats_.maxPauseSeconds, pauseSeconds);
+        if (records == 0 && ok) return;
+
+        ++stats_.saves;
+        stats_.lastRecords = records;
+        stats_.lastSaveSeconds = seconds;
+        stats_.lastPauseSeconds = pauseSeconds;
+        stats_.lastSaveOk = ok;
+    }
+
+    void AutoSaver::SaveNow()
+    {
+        std::unique_lock lock(mutex_);
+        if (stopping_)
+        {
+            lock.unlock();
+            SaveChanges();
+            return;
+        }
+
+        const std::uint64_t ticket = ++requested_;
+        wake_.notify_all();
+        saved_.wait(lock, [this, ticket]
+        {
+            return completed_ >= ticket || stopping_;
+        });
+    }
+
+    void AutoSaver::Stop()
+    {
+        {
+            const std::lock_guard lock(mutex_);
+            if (stopping_) return;
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        saved_.notify_all();
+        if (worker_.joinable()) worker_.join();
+
+        SaveChanges();
+        club_.SetDeferredJournaling(false);
+    }
+
+    AutoSaveStats AutoSaver::GetStats() const
+    {
+        const std::lock_guard lock(mutex_);
+        return stats_;
+    }
+
+    std::size_t AutoSaver::GetDirtyCount() const
+    {
+        return club_.GetDirtyCount();
+    }
+}
@@ -0,0 +1,207 @@
+#include "../include/BinaryIO.h"
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace FootballManagement
+{
+    template <typename T>
+    void BinaryWriter::WriteLittleEndian(T value)
+    {
+        char bytes[sizeof(T)];
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(bytes, &value, sizeof(T));
+        }
+        else
+        {
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+                bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+        body_.append(bytes, sizeof(T));
+    }
+
+    void BinaryWriter::WriteU8(std::uint8_t value)
+    {
+        body_.push_back(static_cast<char>(value));
+    }
+
+    void BinaryWriter::WriteU32(std::uint32_t value)
+    {
+        WriteLittleEndian(value);
+    }
+
+    void BinaryWriter::WriteI32(std::int32_t value)
+    {
+        WriteLittleEndian(static_cast<std::uint32_t>(value));
+    }
+
+    void BinaryWriter::WriteU64(std::uint64_t value)
+    {
+        WriteLittleEndian(value);
+    }
+
+    void BinaryWriter::WriteF64(double value)
+    {
+        WriteLittleEndian(std::bit_cast<std::uint64_t>(value));
+    }
+
+    void BinaryWriter::WriteBool(bool value)
+    {
+        WriteU8(value ? 1 : 0);
+    }
+
+    void BinaryWriter::WriteString(const std::string& value)
+    {
+        const auto [it, inserted] = stringIndex_.try_emplace(
+            value, static_cast<std::uint32_t>(strings_.size()));
+        if (inserted) strings_.push_back(&it->first);
+        WriteU32(it->second);
+    }
+
+    std::size_t BinaryWriter::BeginRecord(std::uint8_t tag)
+    {
+        WriteU8(tag);
+        const std::size_t mark = body_.size();
+        WriteU32(0);
+        return mark;
+    }
+
+    void BinaryWriter::EndRecord(std::size_t mark)
+    {
+        const std::size_t payloadBegin = mark + sizeof(std::uint32_t);
+        const auto length = static_cast<std::uint32_t>(body_.size() -
+            payloadBegin);
+
+        BinaryWriter lengthWriter;
+        lengthWriter.WriteU32(length);
+        body_.replace(mark, sizeof(std::uint32_t), lengthWriter.body_);
+    }
+
+    std::string BinaryWriter::Finish() const
+    {
+        BinaryWriter header;
+        header.body_.append(BINARY_SNAPSHOT_MAGIC);
+        header.WriteU32(BINARY_SNAPSHOT_VERSION);
+        header.WriteU32(static_cast<std::uint32_t>(strings_.size()));
+        for (const std::string* value : strings_)
+        {
+            header.WriteU32(static_cast<std::uint32_t>(value->size()));
+            header.body_.append(*value);
+        }
+
+        std::string result;
+        result.reserve(header.body_.size() + body_.size());
+        result.append(header.body_);
+        result.append(body_);
+        return result;
+    }
+
+    BinaryReader::BinaryReader(std::string_view data) :
+        data_(data), pos_(0), version_(0)
+    {
+        if (!HasMagic(data_))
+            throw std::runtime_error("Файл не є бінарним знімком складу.");
+        pos_ = BINARY_SNAPSHOT_MAGIC.size();
+
+        version_ = ReadU32();
+        if (version_ == 0 || version_ > BINARY_SNAPSHOT_VERSION)
+            throw std::runtime_error(
+                "Непідтримувана версія бінарного знімка.");
+
+        // Кількість рядків — з файлу: перш ніж резервувати, перевіряємо, що
+        // решта даних вміщує хоча б префікси довжини всіх рядків.
+        const std::uint32_t stringCount = ReadU32();
+        Require(static_cast<std::size_t>(stringCount) * sizeof(std::uint32_t));
+        strings_.reserve(stringCount);
+        for (std::uint32_t i = 0; i < stringCount; ++i)
+        {
+            const std::uint32_t length = ReadU32();
+            Require(length);
+            strings_.push_back(data_.substr(pos_, length));
+            pos_ += length;
+        }
+    }
+
+    bool BinaryReader::HasMagic(std::string_view data)
+    {
+        return data.substr(0, BINARY_SNAPSHOT_MAGIC.size()) ==
+            BINARY_SNAPSHOT_MAGIC;
+    }
+
+    std::uint32_t BinaryReader::Version() const { return version_; }
+
+    void BinaryReader::Require(std::size_t bytes) const
+    {
+        if (bytes > data_.size() - pos_)
+            throw std::runtime_error("Пошкоджений бінарний знімок.");
+    }
+
+    template <typename T>
+    T BinaryReader::ReadLittleEndian()
+    {
+        Require(sizeof(T));
+        T value = 0;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(&value, data_.data() + pos_, sizeof(T));
+        }
+        else
+        {
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+                value |= static_cast<T>(
+                    static_cast<unsigned char>(data_[pos_ + i])) << (8 * i);
+        }
+        pos_ += sizeof(T);
+        return value;
+    }
+
+    std::uint8_t BinaryReader::ReadU8()
+    {
+        Require(1);
+        return static_cast<std::uint8_t>(data_[pos_++]);
+    }
+
+    std::uint32_t BinaryReader::ReadU32()
+    {
+        return ReadLittleEndian<std::uint32_t>();
+    }
+
+    std::int32_t BinaryReader::ReadI32()
+    {
+        return static_cast<std::int32_t>(ReadLittleEndian<std::uint32_t>());
+    }
+
+    std::uint64_t BinaryReader::ReadU64()
+    {
+        return ReadLittleEndian<std::uint64_t>();
+    }
+
+    double BinaryReader::ReadF64()
+    {
+        return std::bit_cast<double>(ReadLittleEndian<std::uint64_t>());
+    }
+
+    bool BinaryReader::ReadBool()
+    {
+        return ReadU8() != 0;
+    }
+
+    std::string_view BinaryReader::ReadString()
+    {
+        const std::uint32_t index = ReadU32();
+        if (index >= strings_.size())
+            throw std::runtime_error(
+                "Пошкоджений бінарний знімок (невідомий рядок).");
+        return strings_[index];
+    }
+
+    std::size_t BinaryReader::Position() const { return pos_; }
+
+    void BinaryReader::Seek(std::size_t position)
+    {
+        if (position > data_.size())
+            throw std::runtime_error("Пошкоджений бінарний знімок.");
+        pos_ = position;
+    }
+}
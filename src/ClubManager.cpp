@@ -1,89 +1,451 @@
 #include "../include/ClubManager.h"
+#include "../include/BinaryIO.h"
+#include "../include/PlayerBatches.h"
+#include "../include/PlayerFactory.h"
+#include "../include/RatingKernels.h"
+#include "../include/RecordParser.h"
+#include "../include/RecordSources.h"
+#include "../include/RosterJournal.h"
+#include "../include/TextFolding.h"
+#include <chrono>
+#include <exception>
 #include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <stdexcept>
 #include <iomanip>
+#include <limits>
 #include <typeinfo>
+#include <utility>
 
 namespace FootballManagement
 {
+    namespace
+    {
+        /**
+         * @brief Рядок стовпців гравця.
+         */
+        RosterRow ColumnRow(const Player& player)
+        {
+            RosterRow row;
+            player.WriteColumns(row);
+            row.kind = static_cast<std::uint8_t>(ClassifyPlayer(player).index());
+            return row;
+        }
+
+        /**
+         * @brief Перевіряє умови запиту, що не покриваються індексами.
+         * Числові поля читаються зі стовпців, до об'єкта гравця звертається
+         * лише перевірка громадянства.
+         */
+        bool MatchesAttributes(const RosterColumns& columns, std::size_t slot,
+                               const Player& player, const QueryCriteria& criteria)
+        {
+            if (criteria.position && columns.Positions()[slot] != *criteria.position)
+                return false;
+
+            const int age = columns.Ints(RosterColumn::Age)[slot];
+            if ((criteria.minAge && age < *criteria.minAge) ||
+                (criteria.maxAge && age > *criteria.maxAge))
+                return false;
+
+            const double value = columns.Doubles(RosterColumn::MarketValue)[slot];
+            if ((criteria.minValue && value < *criteria.minValue) ||
+                (criteria.maxValue && value > *criteria.maxValue))
+                return false;
+
+            return !criteria.nationality ||
+                FoldCase(player.GetNationality()) == *criteria.nationality;
+        }
+
+        /**
+         * @brief Ключ сортування результату запиту.
+         */
+        struct OrderedMatch
+        {
+            double number;
+            std::string text;
+            int playerId;
+            std::size_t slot;
+        };
+    }
+
     ClubManager::ClubManager(const std::string& name,
                              double budget) :
-        transferBudget_(budget), clubName_(name)
+        nextId_(FIRST_PLAYER_ID), transferBudget_(budget), clubName_(name),
+        liveSnapshots_(std::make_shared<std::atomic<std::size_t>>(0))
     {
         std::cout << "[INFO] Менеджер клубу \"" << clubName_
             << "\" ініціалізований (Бюджет: " << transferBudget_ << " €)." <<
             std::endl;
     }
 
-    double ClubManager::GetTransferBudget() const { return transferBudget_; }
+    ClubManager::ClubManager(StagingTag, const std::string& name, double budget) :
+        nextId_(FIRST_PLAYER_ID), transferBudget_(budget), clubName_(name),
+        liveSnapshots_(std::make_shared<std::atomic<std::size_t>>(0))
+    {
+    }
+
+    double ClubManager::GetTransferBudget() const
+    {
+        const auto lock = LockShared();
+        return transferBudget_;
+    }
 
     void ClubManager::SetTransferBudget(double budget)
     {
+        const ExclusiveLock lock(*this);
         if (budget < 0.0)
             throw std::invalid_argument(
                 "Бюджет не може бути від’ємним.");
         transferBudget_ = budget;
+        JournalBudget();
     }
 
-    std::string ClubManager::GetClubName() const { return clubName_; }
+    std::string ClubManager::GetClubName() const
+    {
+        const auto lock = LockShared();
+        return clubName_;
+    }
 
-    int ClubManager::GenerateUniqueId() const
+    void ClubManager::ObserveId(int playerId)
     {
-        int maxId = 1000;
-        for (const auto& p : players_)
+        int next = nextId_.load(std::memory_order_relaxed);
+        while (next <= playerId &&
+            !nextId_.compare_exchange_weak(next, playerId + 1,
+                                           std::memory_order_relaxed))
+        {
+        }
+    }
+
+    ClubManager::ExclusiveLock::ExclusiveLock(ClubManager& manager)
+    {
+        const std::thread::id self = std::this_thread::get_id();
+        if (manager.writer_.load(std::memory_order_relaxed) == self) return;
+
+        manager.mutex_.lock();
+        manager.writer_.store(self, std::memory_order_relaxed);
+        owner_ = &manager;
+    }
+
+    ClubManager::ExclusiveLock::~ExclusiveLock() noexcept
+    {
+        if (!owner_) return;
+
+        owner_->writer_.store(std::thread::id(), std::memory_order_relaxed);
+        owner_->mutex_.unlock();
+    }
+
+    std::shared_lock<std::shared_mutex> ClubManager::LockShared() const
+    {
+        // writer_ дорівнює ID цього потоку, лише якщо блокування тримає він сам,
+        // тож для інших потоків порівняння безпечне й без упорядкування.
+        if (writer_.load(std::memory_order_relaxed) == std::this_thread::get_id())
+            return {};
+        return std::shared_lock<std::shared_mutex>(mutex_);
+    }
+
+    int ClubManager::AllocateId()
+    {
+        return nextId_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int ClubManager::AllocateIds(int count)
+    {
+        if (count <= 0)
+            throw std::invalid_argument(
+                "Кількість ID для резервування повинна бути додатною.");
+        return nextId_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    int ClubManager::GetNextId() const
+    {
+        return nextId_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t ClubManager::FindSlot(int playerId) const
+    {
+        const auto it = slotById_.find(playerId);
+        return it == slotById_.end() ? players_.size() : it->second;
+    }
+
+    bool ClubManager::AppendPlayer(std::shared_ptr<Player> player)
+    {
+        if (!AppendUnnamed(std::move(player))) return false;
+
+        const Player& added = *players_.back();
+        nameIndex_.Insert(added.GetPlayerId(), added.GetName());
+        return true;
+    }
+
+    bool ClubManager::AppendUnnamed(std::shared_ptr<Player> player)
+    {
+        const auto [it, inserted] = slotById_.try_emplace(
+            player->GetPlayerId(), players_.size());
+        if (!inserted) return false;
+
+        ObserveId(it->first);
+        statuses_.PushBack(player->GetStatusFlags());
+        IndexNumericFields(*player);
+        columns_.PushBack(ColumnRow(*player));
+        published_.PushBack(player);
+        placedAt_.push_back(snapshotCount_.load(std::memory_order_relaxed));
+        players_.push_back(std::move(player));
+        InvalidateRanking();
+        return true;
+    }
+
+    void ClubManager::EraseSlot(std::size_t slot)
+    {
+        const int playerId = players_[slot]->GetPlayerId();
+        slotById_.erase(playerId);
+        nameIndex_.Erase(playerId);
+        valueIndex_.Erase(playerId);
+        ageIndex_.Erase(playerId);
+        salaryIndex_.Erase(playerId);
+
+        // Порядок складу (перегляд, збереження, знімки) не змінюється, як
+        // і до індексу за ID: наступні слоти зсуваються на один ліворуч.
+        players_.erase(players_.begin() + static_cast<std::ptrdiff_t>(slot));
+        placedAt_.erase(placedAt_.begin() + static_cast<std::ptrdiff_t>(slot));
+        published_.Erase(slot);
+        statuses_.Remove(slot);
+        columns_.Remove(slot);
+
+        // ID беруться зі стовпця, а не з об'єктів гравців (без промахів кешу).
+        const std::span<const int> ids = columns_.PlayerIds();
+        for (std::size_t i = slot; i < ids.size(); ++i)
+            slotById_.find(ids[i])->second = i;
+        InvalidateRanking();
+    }
+
+    void ClubManager::ResetRoster(std::size_t capacity)
+    {
+        players_.clear();
+        slotById_.clear();
+        nameIndex_.Clear();
+        statuses_.Clear();
+        valueIndex_.Clear();
+        ageIndex_.Clear();
+        salaryIndex_.Clear();
+        columns_.Clear();
+        published_.Clear();
+        placedAt_.clear();
+        InvalidateRanking();
+        nextId_.store(FIRST_PLAYER_ID, std::memory_order_relaxed);
+        players_.reserve(capacity);
+        placedAt_.reserve(capacity);
+        slotById_.reserve(capacity);
+        nameIndex_.Reserve(capacity);
+        statuses_.Reserve(capacity);
+        valueIndex_.Reserve(capacity);
+        ageIndex_.Reserve(capacity);
+        salaryIndex_.Reserve(capacity);
+        columns_.Reserve(capacity);
+        PlayerFactory::GetInstance().ReservePooled(capacity);
+    }
+
+    void ClubManager::AdoptRoster(ClubManager&& staged)
+    {
+        // Склад замінюється вмістом файлу, тож незбережених змін не лишається.
+        dirtyIds_.clear();
+        budgetDirty_ = false;
+        players_ = std::move(staged.players_);
+        slotById_ = std::move(staged.slotById_);
+        nameIndex_ = std::move(staged.nameIndex_);
+        statuses_ = std::move(staged.statuses_);
+        valueIndex_ = std::move(staged.valueIndex_);
+        ageIndex_ = std::move(staged.ageIndex_);
+        salaryIndex_ = std::move(staged.salaryIndex_);
+        columns_ = std::move(staged.columns_);
+        published_ = std::move(staged.published_);
+        // Жоден знімок цього менеджера ще не бачив нових об'єктів.
+        placedAt_.assign(players_.size(),
+                         snapshotCount_.load(std::memory_order_relaxed));
+        nextId_.store(staged.nextId_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+        transferBudget_ = staged.transferBudget_;
+        clubName_ = std::move(staged.clubName_);
+        InvalidateRanking();
+    }
+
+    void ClubManager::IndexNumericFields(const Player& player)
+    {
+        const int playerId = player.GetPlayerId();
+        valueIndex_.Upsert(playerId, player.GetMarketValue());
+        ageIndex_.Upsert(playerId, player.GetAge());
+
+        if (const auto* contracted = dynamic_cast<const ContractedPlayer*>(&player))
+            salaryIndex_.Upsert(playerId, contracted->GetSalary());
+        else
+            salaryIndex_.Erase(playerId);
+    }
+
+    void ClubManager::ReindexPlayer(std::size_t slot)
+    {
+        const Player& player = *players_[slot];
+        nameIndex_.Insert(player.GetPlayerId(), player.GetName());
+        statuses_.Set(slot, player.GetStatusFlags());
+        IndexNumericFields(player);
+        columns_.Set(slot, ColumnRow(player));
+        published_.Set(slot, players_[slot]);
+        InvalidateRanking();
+    }
+
+    void ClubManager::RebuildIndex()
+    {
+        slotById_.clear();
+        slotById_.reserve(players_.size());
+        statuses_.Clear();
+        statuses_.Reserve(players_.size());
+        columns_.Clear();
+        columns_.Reserve(players_.size());
+        published_.Clear();
+        for (std::size_t i = 0; i < players_.size(); ++i)
+        {
+            slotById_[players_[i]->GetPlayerId()] = i;
+            statuses_.PushBack(players_[i]->GetStatusFlags());
+            columns_.PushBack(ColumnRow(*players_[i]));
+            published_.PushBack(players_[i]);
+        }
+    }
+
+    Player& ClubManager::WritablePlayer(std::size_t slot)
+    {
+        // Об'єкт, що потрапив у слот до останнього знімка, може бути в ньому;
+        // якщо живих знімків немає, копія не потрібна.
+        const std::uint64_t current = snapshotCount_.load(std::memory_order_relaxed);
+        if (placedAt_[slot] < current &&
+            liveSnapshots_->load(std::memory_order_acquire) > 0)
+        {
+            players_[slot] = players_[slot]->Clone();
+            placedAt_[slot] = current;
+        }
+        return *players_[slot];
+    }
+
+    void ClubManager::InvalidateRanking() { ranking_.reset(); }
+
+    RankingView& ClubManager::Ranking() const
+    {
+        if (!ranking_)
+            ranking_.emplace(columns_.Doubles(RosterColumn::Rating),
+                             columns_.PlayerIds());
+        return *ranking_;
+    }
+
+    std::shared_ptr<Player> ClubManager::FindById(int playerId) const
+    {
+        const auto lock = LockShared();
+        const std::size_t slot = FindSlot(playerId);
+        return slot == players_.size() ? nullptr : players_[slot];
+    }
+
+    std::size_t ClubManager::GetPlayerCount() const
+    {
+        const auto lock = LockShared();
+        return players_.size();
+    }
+
+    void ClubManager::JournalChange(std::string_view op,
+                                    std::string_view payload)
+    {
+        if (!journal_) return;
+
+        journal_->Append(op, payload);
+        if (journal_->NeedsCompaction())
+            journal_->Compact(*this);
+    }
+
+    void ClubManager::JournalPlayer(std::string_view op, const Player& player)
+    {
+        if (deferJournal_)
         {
-            if (p->GetPlayerId() > maxId)
-                maxId = p->GetPlayerId();
+            dirtyIds_.insert(player.GetPlayerId());
+            return;
         }
-        return maxId + 1;
+        if (!journal_) return;
+
+        journalBuffer_.Clear();
+        player.AppendTo(journalBuffer_);
+        JournalChange(op, journalBuffer_.View());
+    }
+
+    void ClubManager::JournalRemoval(int playerId)
+    {
+        if (deferJournal_)
+        {
+            dirtyIds_.insert(playerId);
+            return;
+        }
+        JournalChange(RosterJournal::OP_REMOVE, std::to_string(playerId));
+    }
+
+    void ClubManager::JournalBudget()
+    {
+        if (deferJournal_)
+        {
+            budgetDirty_ = true;
+            return;
+        }
+        // Найкоротший точний запис, як у знімку: програвання відновлює бюджет
+        // біт у біт (std::to_string лишає 6 знаків після коми).
+        journalBuffer_.Clear();
+        journalBuffer_.AppendDouble(transferBudget_);
+        JournalChange(RosterJournal::OP_BUDGET, journalBuffer_.View());
     }
 
     void ClubManager::AddPlayer(std::shared_ptr<Player> p)
     {
+        const ExclusiveLock lock(*this);
         if (!p)
             throw std::invalid_argument("Неможливо додати порожнього гравця.");
 
-        if (p && p->GetPlayerId() == 0)
-            p->SetPlayerId(GenerateUniqueId());
+        if (p->GetPlayerId() == 0)
+            p->SetPlayerId(AllocateId());
 
-        players_.push_back(p);
+        if (!AppendPlayer(p))
+            throw std::invalid_argument("Гравець з ID " +
+                std::to_string(p->GetPlayerId()) + " уже є у складі.");
+        JournalPlayer(RosterJournal::OP_ADD, *p);
         std::cout << "[SUCCESS] Додано гравця: " << p->GetName()
             << " (ID: " << p->GetPlayerId() << ")." << std::endl;
     }
 
     void ClubManager::ViewAllPlayers() const
     {
-        std::cout << "\n=== СКЛАД КЛУБУ \"" << clubName_ << "\" ===" <<
-            std::endl;
-        if (players_.empty())
-        {
-            std::cout << "Немає зареєстрованих гравців." << std::endl;
-            return;
-        }
+        Snapshot().ViewAllPlayers();
+    }
 
-        for (const auto& p : players_)
-        {
-            p->ShowInfo();
-            std::cout << "--------------------------------------------" <<
-                std::endl;
-        }
+    RosterSnapshot ClubManager::Snapshot() const
+    {
+        const auto lock = LockShared();
+        const std::uint64_t version =
+            snapshotCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        // «Оренда» знімка: поки жива хоч одна копія, менеджер копіює гравців
+        // перед зміною; лічильник спільний, тож переживає і сам менеджер.
+        liveSnapshots_->fetch_add(1, std::memory_order_relaxed);
+        std::shared_ptr<const void> lease(
+            nullptr, [counter = liveSnapshots_](const void*)
+            {
+                counter->fetch_sub(1, std::memory_order_release);
+            });
+        return RosterSnapshot(published_, clubName_, transferBudget_, GetNextId(),
+                              version, std::move(lease));
     }
 
     void ClubManager::RemovePlayers(int playerId)
     {
-        const auto before = players_.size();
-        players_.erase(std::remove_if(players_.begin(), players_.end(),
-                                      [playerId](const auto& p)
-                                      {
-                                          return p->GetPlayerId() == playerId;
-                                      }),
-                       players_.end());
-
-        if (players_.size() < before)
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot != players_.size())
+        {
+            EraseSlot(slot);
+            JournalRemoval(playerId);
             std::cout << "[SUCCESS] Гравця з ID " << playerId << " видалено." <<
                 std::endl;
+        }
         else
             std::cout << "[FAIL] Гравця з ID " << playerId << " не знайдено." <<
                 std::endl;
@@ -91,60 +453,599 @@ namespace FootballManagement
 
     void ClubManager::SortByPerformanceRating()
     {
-        std::sort(players_.begin(), players_.end(),
-                  [](const auto& a, const auto& b)
-                  {
-                      return a->CalculatePerformanceRating() > b->
-                          CalculatePerformanceRating();
-                  });
+        const ExclusiveLock lock(*this);
+        std::vector<std::shared_ptr<Player>> ordered;
+        std::vector<std::uint64_t> placedAt;
+        ordered.reserve(players_.size());
+        placedAt.reserve(players_.size());
+        for (const RankingEntry& entry : Ranking().Ranked())
+        {
+            const std::size_t slot = FindSlot(entry.playerId);
+            ordered.push_back(std::move(players_[slot]));
+            placedAt.push_back(placedAt_[slot]);
+        }
+
+        players_ = std::move(ordered);
+        placedAt_ = std::move(placedAt);
+        RebuildIndex();
         std::cout << "[INFO] Гравці відсортовані за рейтингом ефективності." <<
             std::endl;
     }
 
-    std::vector<std::shared_ptr<Player>> ClubManager::SearchByName(
-        const std::string& q) const
+    std::vector<Player*> ClubManager::TopPerformers(
+        std::size_t k) const
     {
-        std::vector<std::shared_ptr<Player>> results;
-        std::string lowerQuery = nameQuery;
-        std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(),
-                       ::tolower);
+        const auto lock = LockShared();
+        const std::lock_guard<std::mutex> rankingLock(rankingMutex_);
+        std::vector<Player*> top;
+        const std::vector<RankingEntry> entries = Ranking().TopK(k);
+        top.reserve(entries.size());
+        for (const RankingEntry& entry : entries)
+            top.push_back(players_[FindSlot(entry.playerId)].get());
+        return top;
+    }
 
-        for (const auto& p : players_)
+    void ClubManager::ViewRanking(std::size_t limit) const
+    {
+        const auto lock = LockShared();
+        const std::lock_guard<std::mutex> rankingLock(rankingMutex_);
+        std::cout << "\n=== РЕЙТИНГ ГРАВЦІВ \"" << clubName_ << "\" ===" <<
+            std::endl;
+        if (players_.empty())
         {
-            std::string name = p->GetName();
-            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            std::cout << "Немає зареєстрованих гравців." << std::endl;
+            return;
+        }
 
-            if (name.find(lowerQuery) != std::string::npos)
-                results.push_back(p);
+        const std::size_t count = limit == 0 ? players_.size() : limit;
+        std::size_t place = 1;
+        for (const RankingEntry& entry : Ranking().TopK(count))
+        {
+            const auto& p = players_[FindSlot(entry.playerId)];
+            std::cout << std::setw(4) << place++ << ". " << p->GetName()
+                << " (ID: " << entry.playerId << ") — " << std::fixed
+                << std::setprecision(2) << entry.rating << std::endl;
         }
+    }
+
+    std::vector<Player*> ClubManager::SearchByName(
+        const std::string& nameQuery, std::size_t limit) const
+    {
+        const auto lock = LockShared();
+        std::vector<Player*> results;
+        const std::vector<int> ids = nameIndex_.Search(nameQuery, limit);
+        results.reserve(ids.size());
+        for (const int id : ids)
+            results.push_back(players_[FindSlot(id)].get());
         return results;
     }
 
-    std::vector<std::shared_ptr<Player>> ClubManager::FilterByStatus(
+    std::vector<Player*> ClubManager::FilterByStatus(
         const std::string& status) const
     {
-        std::vector<std::shared_ptr<Player>> filtered;
-        std::string lowerStatus = status;
-        std::transform(lowerStatus.begin(), lowerStatus.end(),
-                       lowerStatus.begin(), ::tolower);
+        return FilterByStatus(ParseStatusQuery(status));
+    }
 
-        for (const auto& p : players_)
+    std::vector<Player*> ClubManager::FilterByStatus(
+        PlayerStatus required, PlayerStatus excluded) const
+    {
+        return FilterByStatus(std::vector<StatusFilter>{{required, excluded}});
+    }
+
+    std::vector<Player*> ClubManager::FilterByStatus(
+        const std::vector<StatusFilter>& anyOf) const
+    {
+        const auto lock = LockShared();
+        std::vector<Player*> filtered;
+        const std::vector<std::size_t> slots = statuses_.Select(anyOf);
+        filtered.reserve(slots.size());
+        for (const std::size_t slot : slots)
+            filtered.push_back(players_[slot].get());
+        return filtered;
+    }
+
+    std::size_t ClubManager::CountByStatus(
+        const std::vector<StatusFilter>& anyOf) const
+    {
+        const auto lock = LockShared();
+        return statuses_.Count(anyOf);
+    }
+
+    std::vector<int> ClubManager::FindByMarketValue(double minValue,
+                                                    double maxValue) const
+    {
+        const auto lock = LockShared();
+        return valueIndex_.Range(minValue, maxValue);
+    }
+
+    std::vector<int> ClubManager::FindByAge(int minAge, int maxAge) const
+    {
+        const auto lock = LockShared();
+        return ageIndex_.Range(minAge, maxAge);
+    }
+
+    std::vector<int> ClubManager::FindBySalary(double minSalary,
+                                               double maxSalary) const
+    {
+        const auto lock = LockShared();
+        return salaryIndex_.Range(minSalary, maxSalary);
+    }
+
+    bool ClubManager::UpdatePlayerMarketValue(int playerId,
+                                              double percentageChange)
+    {
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot == players_.size()) return false;
+
+        WritablePlayer(slot).UpdateMarketValue(percentageChange);
+        RecordPlayerUpdate(playerId);
+        return true;
+    }
+
+    bool ClubManager::CelebratePlayerBirthday(int playerId)
+    {
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot == players_.size()) return false;
+
+        WritablePlayer(slot).CelebrateBirthday();
+        RecordPlayerUpdate(playerId);
+        return true;
+    }
+
+    bool ClubManager::AdjustPlayerSalary(int playerId, double percentageChange)
+    {
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot == players_.size()) return false;
+
+        if (!dynamic_cast<const ContractedPlayer*>(players_[slot].get()))
+            return false;
+
+        static_cast<ContractedPlayer&>(WritablePlayer(slot)).AdjustSalary(
+            percentageChange);
+        RecordPlayerUpdate(playerId);
+        return true;
+    }
+
+    double WorkerThroughput::PlayersPerSecond() const
+    {
+        return seconds > 0.0 ? static_cast<double>(scanned) / seconds : 0.0;
+    }
+
+    MarketAdjustmentReport ClubManager::ApplyMarketAdjustment(
+        const std::function<bool(const Player&)>& predicate,
+        double percentageChange, ThreadPool& pool)
+    {
+        const ExclusiveLock lock(*this);
+        // Менші частини не окупають передачу задачі потоку.
+        constexpr std::size_t MIN_PART_SIZE = 4096;
+        using Clock = std::chrono::steady_clock;
+
+        MarketAdjustmentReport report;
+        const auto start = Clock::now();
+        const std::size_t size = players_.size();
+        const std::size_t parts = std::max<std::size_t>(
+            1, std::min(pool.ThreadCount(),
+                        (size + MIN_PART_SIZE - 1) / MIN_PART_SIZE));
+        report.workers.resize(parts);
+        std::vector<std::vector<std::size_t>> changed(parts);
+
+        std::vector<std::future<void>> pending;
+        pending.reserve(parts);
+        for (std::size_t part = 0; part < parts; ++part)
         {
-            std::string playerStatus = p->GetStatus();
-            std::transform(playerStatus.begin(), playerStatus.end(),
-                           playerStatus.begin(), ::tolower);
+            const std::size_t begin = size * part / parts;
+            const std::size_t end = size * (part + 1) / parts;
+            pending.push_back(pool.Submit([&, part, begin, end]
+            {
+                const auto partStart = Clock::now();
+                WorkerThroughput& stats = report.workers[part];
+                stats.firstSlot = begin;
+                for (std::size_t slot = begin; slot < end; ++slot)
+                {
+                    if (!predicate(*players_[slot])) continue;
 
-            if (playerStatus.find(lowerStatus) != std::string::npos)
-                filtered.push_back(p);
+                    Player& player = WritablePlayer(slot);
+                    player.UpdateMarketValue(percentageChange);
+                    // Частини не перетинаються, тож рядки стовпців різних
+                    // потоків не конфліктують.
+                    columns_.Set(slot, ColumnRow(player));
+                    changed[part].push_back(slot);
+                }
+                stats.scanned = end - begin;
+                stats.updated = changed[part].size();
+                stats.seconds = std::chrono::duration<double>(
+                    Clock::now() - partStart).count();
+            }));
+        }
+        // Виняток умови не перериває решту частин: змінених гравців однаково
+        // треба проіндексувати, тож він передається далі наприкінці.
+        std::exception_ptr failure;
+        for (auto& future : pending)
+        {
+            try
+            {
+                future.get();
+            }
+            catch (...)
+            {
+                if (!failure) failure = std::current_exception();
+            }
         }
 
-        return filtered;
+        const auto indexStart = Clock::now();
+        std::vector<NumericIndex::Entry> values;
+        for (const auto& slots : changed)
+        {
+            for (const std::size_t slot : slots)
+            {
+                values.push_back({players_[slot]->GetMarketValue(),
+                                  players_[slot]->GetPlayerId()});
+                published_.Set(slot, players_[slot]);
+            }
+        }
+        valueIndex_.UpsertBatch(values);
+        if (!values.empty()) InvalidateRanking();
+        report.indexSeconds = std::chrono::duration<double>(
+            Clock::now() - indexStart).count();
+
+        // Без журналу й автозбереження цей прохід пропускається.
+        const bool trackChanges = journal_ || deferJournal_;
+        for (const auto& slots : changed)
+        {
+            for (std::size_t i = 0; trackChanges && i < slots.size(); ++i)
+                JournalPlayer(RosterJournal::OP_UPDATE, *players_[slots[i]]);
+        }
+
+        report.updated = values.size();
+        report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::cout << "[INFO] Ринкову вартість змінено на " << percentageChange
+            << "% для " << report.updated << " з " << size << " гравців ("
+            << parts << " потоків, " << report.seconds * 1e3 << " мс)." << std::endl;
+        for (std::size_t part = 0; part < parts; ++part)
+        {
+            const WorkerThroughput& stats = report.workers[part];
+            std::cout << "[INFO]   Потік " << part + 1 << ": слоти "
+                << stats.firstSlot << ".." << stats.firstSlot + stats.scanned
+                << ", змінено " << stats.updated << ", "
+                << static_cast<long long>(stats.PlayersPerSecond())
+                << " гравців/с." << std::endl;
+        }
+        return report;
+    }
+
+    const RosterColumns& ClubManager::Columns() const { return columns_; }
+
+    ColumnSummary ClubManager::SummarizeColumn(RosterColumn column) const
+    {
+        const auto lock = LockShared();
+        return columns_.Summarize(column);
+    }
+
+    std::vector<double> ClubManager::RevaluateRoster() const
+    {
+        const auto lock = LockShared();
+        // Стовпці обробляються шматками, щоб проміжні масиви лишалися в кеші.
+        constexpr std::size_t CHUNK = 4096;
+        const std::size_t size = columns_.Size();
+        std::vector<double> values(size);
+        std::vector<double> keeperRatings(CHUNK), keeperValues(CHUNK),
+                            agentValues(CHUNK), contractedValues(CHUNK);
+
+        const auto ints = [this](RosterColumn column, std::size_t begin,
+                                 std::size_t count)
+        {
+            return columns_.Ints(column).subspan(begin, count);
+        };
+        const auto doubles = [this](RosterColumn column, std::size_t begin,
+                                    std::size_t count)
+        {
+            return columns_.Doubles(column).subspan(begin, count);
+        };
+
+        for (std::size_t begin = 0; begin < size; begin += CHUNK)
+        {
+            const std::size_t n = std::min(CHUNK, size - begin);
+            const std::span<double> keeperRating(keeperRatings.data(), n);
+            const std::span<const double> market =
+                doubles(RosterColumn::MarketValue, begin, n);
+
+            GoalkeeperRatings({ints(RosterColumn::MatchesPlayed, begin, n),
+                               ints(RosterColumn::Saves, begin, n),
+                               ints(RosterColumn::CleanSheets, begin, n),
+                               ints(RosterColumn::GoalsConceded, begin, n),
+                               ints(RosterColumn::PenaltiesSaved, begin, n)},
+                              keeperRating);
+            GoalkeeperValues(market, keeperRating,
+                             ints(RosterColumn::CleanSheets, begin, n),
+                             {keeperValues.data(), n});
+            FreeAgentValues(market, ints(RosterColumn::MonthsWithoutClub, begin, n),
+                            {agentValues.data(), n});
+            // Рейтинг гравця з контрактом не залежить від статистики,
+            // тож береться зі стовпця.
+            ContractedValues(market, doubles(RosterColumn::Rating, begin, n),
+                             doubles(RosterColumn::Salary, begin, n),
+                             {contractedValues.data(), n});
+
+            const std::span<const std::uint8_t> kinds =
+                columns_.Kinds().subspan(begin, n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                switch (kinds[i])
+                {
+                case PlayerKindOf<Goalkeeper>():
+                    values[begin + i] = keeperValues[i];
+                    break;
+                case PlayerKindOf<FreeAgent>():
+                    values[begin + i] = agentValues[i];
+                    break;
+                case PlayerKindOf<ContractedPlayer>():
+                    values[begin + i] = contractedValues[i];
+                    break;
+                default: values[begin + i] = players_[begin + i]->CalculateValue();
+                    break;
+                }
+            }
+        }
+        return values;
+    }
+
+    double ClubManager::CalculateSquadValue() const
+    {
+        double total = 0.0;
+        for (const double value : RevaluateRoster()) total += value;
+        return total;
+    }
+
+    std::vector<Player*> ClubManager::TopByColumn(
+        RosterColumn column, std::size_t k, bool descending) const
+    {
+        const auto lock = LockShared();
+        std::vector<Player*> top;
+        const std::vector<int> ids = columns_.TopK(column, k, descending);
+        top.reserve(ids.size());
+        for (const int id : ids)
+            top.push_back(players_[FindSlot(id)].get());
+        return top;
+    }
+
+    RosterQuery ClubManager::Query() const { return RosterQuery(*this); }
+
+    void ClubManager::VisitQuery(
+        const QueryCriteria& criteria,
+        const std::function<bool(const Player&)>& visit) const
+    {
+        const auto lock = LockShared();
+        if (players_.empty() || (criteria.status && criteria.status->empty()))
+            return;
+
+        const std::size_t limit = criteria.limit == 0
+                                      ? players_.size()
+                                      : criteria.limit;
+        const bool hasAttributes = criteria.position || criteria.minAge ||
+            criteria.maxAge || criteria.minValue || criteria.maxValue ||
+            criteria.nationality;
+        const bool hasSalary = criteria.minSalary || criteria.maxSalary;
+
+        constexpr double INF = std::numeric_limits<double>::infinity();
+        const double minValue = criteria.minValue.value_or(-INF);
+        const double maxValue = criteria.maxValue.value_or(INF);
+        const double minAge = criteria.minAge ? *criteria.minAge : -INF;
+        const double maxAge = criteria.maxAge ? *criteria.maxAge : INF;
+        const double minSalary = criteria.minSalary.value_or(-INF);
+        const double maxSalary = criteria.maxSalary.value_or(INF);
+
+        // Кандидати беруться з найвужчого індексу; розмір діапазону
+        // рахується по блоках індексу без обходу елементів.
+        enum class Source { Name, Value, Age, Salary, Status, Scan };
+        Source source = Source::Scan;
+        std::size_t estimate = players_.size();
+        if (criteria.nameContains)
+            source = Source::Name;
+        else
+        {
+            if (criteria.status)
+            {
+                estimate = statuses_.Count(*criteria.status);
+                source = Source::Status;
+            }
+            const auto consider = [&](bool present, const NumericIndex& index,
+                                      double low, double high, Source candidate)
+            {
+                if (!present) return;
+                const std::size_t count = index.CountInRange(low, high);
+                if (count < estimate)
+                {
+                    estimate = count;
+                    source = candidate;
+                }
+            };
+            consider(criteria.minValue || criteria.maxValue, valueIndex_,
+                     minValue, maxValue, Source::Value);
+            consider(criteria.minAge || criteria.maxAge, ageIndex_, minAge,
+                     maxAge, Source::Age);
+            consider(hasSalary, salaryIndex_, minSalary, maxSalary,
+                     Source::Salary);
+        }
+
+        // Сортування з обмеженням за індексованим полем читає індекс уже
+        // впорядкованим і зупиняється після limit результатів; дрібну
+        // вибірку дешевше просто відсортувати.
+        constexpr std::size_t SMALL_CANDIDATE_SET = 4096;
+        const Source orderSource = criteria.order == QueryOrder::MarketValue
+                                       ? Source::Value
+                                       : criteria.order == QueryOrder::Age
+                                       ? Source::Age
+                                       : Source::Scan;
+        if (orderSource != Source::Scan && criteria.limit != 0 &&
+            source != Source::Name && estimate > SMALL_CANDIDATE_SET)
+            source = orderSource;
+        const bool streamOrdered = orderSource != Source::Scan &&
+            source == orderSource;
+
+        const auto accepts = [&](std::size_t slot)
+        {
+            if (criteria.status && source != Source::Status)
+            {
+                const PlayerStatus flags = statuses_.Get(slot);
+                if (std::none_of(criteria.status->begin(), criteria.status->end(),
+                                 [flags](const StatusFilter& filter)
+                                 {
+                                     return filter.Matches(flags);
+                                 }))
+                    return false;
+            }
+            if (hasSalary)
+            {
+                // Зарплату мають лише гравці з контрактом; в інших стовпець нульовий.
+                const double salary = columns_.Doubles(RosterColumn::Salary)[slot];
+                if (!HasStatus(statuses_.Get(slot), PlayerStatus::Contracted) ||
+                    (criteria.minSalary && salary < *criteria.minSalary) ||
+                    (criteria.maxSalary && salary > *criteria.maxSalary))
+                    return false;
+            }
+            return !hasAttributes ||
+                MatchesAttributes(columns_, slot, *players_[slot], criteria);
+        };
+
+        const auto forEachCandidate =
+            [&](const std::function<bool(std::size_t)>& emit)
+        {
+            const bool descending = streamOrdered && criteria.descending;
+            const auto emitId = [&](int playerId)
+            {
+                return emit(FindSlot(playerId));
+            };
+
+            switch (source)
+            {
+            case Source::Name:
+            {
+                // Без інших умов і сортування обмеження передається індексу.
+                const bool pushLimit = !criteria.status && !hasAttributes &&
+                    !hasSalary && criteria.order == QueryOrder::None;
+                for (const int id : nameIndex_.Search(*criteria.nameContains,
+                                                      pushLimit ? limit : 0))
+                {
+                    if (!emitId(id)) return;
+                }
+                break;
+            }
+            case Source::Value:
+                valueIndex_.ForEachInRange(minValue, maxValue, descending,
+                                           emitId);
+                break;
+            case Source::Age:
+                ageIndex_.ForEachInRange(minAge, maxAge, descending, emitId);
+                break;
+            case Source::Salary:
+                salaryIndex_.ForEachInRange(minSalary, maxSalary, descending,
+                                            emitId);
+                break;
+            case Source::Status:
+                statuses_.ForEachSlot(*criteria.status, emit);
+                break;
+            case Source::Scan:
+                for (std::size_t slot = 0; slot < players_.size(); ++slot)
+                {
+                    if (!emit(slot)) return;
+                }
+                break;
+            }
+        };
+
+        std::size_t emitted = 0;
+        if (criteria.order == QueryOrder::None || streamOrdered)
+        {
+            forEachCandidate([&](std::size_t slot)
+            {
+                if (!accepts(slot)) return true;
+                return visit(*players_[slot]) && ++emitted < limit;
+            });
+            return;
+        }
+
+        if (criteria.order == QueryOrder::Rating && criteria.descending &&
+            (source == Source::Status || source == Source::Scan) &&
+            estimate > SMALL_CANDIDATE_SET)
+        {
+            // Рейтинг уже є індексом: префікс досортовується порціями, що
+            // подвоюються, доки не набереться limit результатів.
+            const std::lock_guard<std::mutex> rankingLock(rankingMutex_);
+            RankingView& ranking = Ranking();
+            std::size_t position = 0;
+            std::size_t batch = std::max<std::size_t>(64, limit * 2);
+            while (emitted < limit && position < ranking.Size())
+            {
+                const std::span<const RankingEntry> prefix =
+                    ranking.Prefix(position + batch);
+                for (; position < prefix.size() && emitted < limit; ++position)
+                {
+                    const std::size_t slot = FindSlot(prefix[position].playerId);
+                    if (!accepts(slot)) continue;
+                    if (!visit(*players_[slot])) return;
+                    ++emitted;
+                }
+                batch *= 2;
+            }
+            return;
+        }
+
+        std::vector<OrderedMatch> matches;
+        forEachCandidate([&](std::size_t slot)
+        {
+            if (!accepts(slot)) return true;
+
+            const Player& player = *players_[slot];
+            OrderedMatch match{0.0, {}, player.GetPlayerId(), slot};
+            switch (criteria.order)
+            {
+            case QueryOrder::Name: match.text = player.GetName();
+                break;
+            case QueryOrder::Age:
+                match.number = columns_.Ints(RosterColumn::Age)[slot];
+                break;
+            case QueryOrder::MarketValue:
+                match.number = columns_.Doubles(RosterColumn::MarketValue)[slot];
+                break;
+            case QueryOrder::Rating:
+                match.number = columns_.Doubles(RosterColumn::Rating)[slot];
+                break;
+            default: match.number = player.GetPlayerId();
+                break;
+            }
+            matches.push_back(std::move(match));
+            return true;
+        });
+
+        const auto before = [&criteria](const OrderedMatch& a,
+                                        const OrderedMatch& b)
+        {
+            if (a.number != b.number)
+                return criteria.descending ? a.number > b.number
+                                           : a.number < b.number;
+            if (a.text != b.text)
+                return criteria.descending ? a.text > b.text : a.text < b.text;
+            return a.playerId < b.playerId;
+        };
+        const std::size_t count = std::min(limit, matches.size());
+        std::partial_sort(matches.begin(), matches.begin() + count,
+                          matches.end(), before);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (!visit(*players_[matches[i].slot])) return;
+        }
     }
 
     bool ClubManager::SignFreeAgent(std::shared_ptr<FreeAgent> player,
                                     double salaryOffer,
                                     const std::string& contractUntil)
     {
+        const ExclusiveLock lock(*this);
         if (!player)
         {
             std::cout << "[FAIL] Неможливо підписати: гравець не визначений." <<
@@ -165,29 +1066,209 @@ namespace FootballManagement
             return false;
         }
 
-        if (!player->NegotiateOffer(salaryOffer))
+        // Агента зі складу змінюємо через WritablePlayer, щоб знімки
+        // зберегли його стан до підписання.
+        FreeAgent* agent = player.get();
+        const std::size_t slot = FindSlot(player->GetPlayerId());
+        const bool inRoster = slot != players_.size() &&
+            dynamic_cast<const FreeAgent*>(players_[slot].get());
+        if (inRoster)
+            agent = &static_cast<FreeAgent&>(WritablePlayer(slot));
+
+        if (!agent->NegotiateOffer(salaryOffer))
         {
+            // Відмова не змінює агента, але слот міг отримати копію.
+            if (inRoster) published_.Set(slot, players_[slot]);
             std::cout << "[FAIL] Гравець відхилив пропозицію." << std::endl;
             return false;
         }
 
-        player->AcceptContract(clubName_);
+        agent->AcceptContract(clubName_);
         transferBudget_ -= salaryOffer;
 
-        std::cout << "[SUCCESS] Вільний агент " << player->GetName()
+        RecordPlayerUpdate(agent->GetPlayerId());
+        JournalBudget();
+
+        std::cout << "[SUCCESS] Вільний агент " << agent->GetName()
             << " підписаний із клубом " << clubName_
             << ". Залишок бюджету: " << transferBudget_ << " €." << std::endl;
 
         return true;
     }
 
+    bool ClubManager::RenamePlayer(int playerId, const std::string& newName)
+    {
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot == players_.size()) return false;
+
+        WritablePlayer(slot).SetName(newName);
+        RecordPlayerUpdate(playerId);
+        return true;
+    }
+
+    bool ClubManager::ModifyPlayer(int playerId,
+                                   const std::function<void(Player&)>& change)
+    {
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot == players_.size()) return false;
+
+        change(WritablePlayer(slot));
+        RecordPlayerUpdate(playerId);
+        return true;
+    }
+
+    void ClubManager::RecordPlayerUpdate(int playerId)
+    {
+        const ExclusiveLock lock(*this);
+        const std::size_t slot = FindSlot(playerId);
+        if (slot == players_.size()) return;
+
+        ReindexPlayer(slot);
+        JournalPlayer(RosterJournal::OP_UPDATE, *players_[slot]);
+    }
+
+    void ClubManager::AttachJournal(std::shared_ptr<RosterJournal> journal)
+    {
+        const ExclusiveLock lock(*this);
+        journal_ = std::move(journal);
+    }
+
+    std::shared_ptr<RosterJournal> ClubManager::GetJournal() const
+    {
+        const auto lock = LockShared();
+        return journal_;
+    }
+
+    void ClubManager::SetDeferredJournaling(bool deferred)
+    {
+        const ExclusiveLock lock(*this);
+        deferJournal_ = deferred;
+    }
+
+    RosterChanges ClubManager::TakeChanges()
+    {
+        using Clock = std::chrono::steady_clock;
+        std::unordered_set<int> taken;
+        bool budgetChanged = false;
+        std::optional<RosterSnapshot> snapshot;
+        double lockSeconds = 0.0;
+        {
+            const ExclusiveLock lock(*this);
+            const auto locked = Clock::now();
+            taken.swap(dirtyIds_);
+            budgetChanged = std::exchange(budgetDirty_, false);
+            snapshot.emplace(Snapshot());
+            lockSeconds = std::chrono::duration<double>(
+                Clock::now() - locked).count();
+        }
+
+        // Набір перетворюється на список уже без блокування.
+        std::vector<int> playerIds(taken.begin(), taken.end());
+        std::sort(playerIds.begin(), playerIds.end());
+        return RosterChanges{std::move(*snapshot), std::move(playerIds),
+                             budgetChanged, lockSeconds};
+    }
+
+    void ClubManager::RequeueChanges(const std::vector<int>& playerIds,
+                                     bool budgetChanged)
+    {
+        const ExclusiveLock lock(*this);
+        dirtyIds_.insert(playerIds.begin(), playerIds.end());
+        budgetDirty_ = budgetDirty_ || budgetChanged;
+    }
+
+    std::size_t ClubManager::GetDirtyCount() const
+    {
+        const auto lock = LockShared();
+        return dirtyIds_.size();
+    }
+
+    bool ClubManager::ApplyJournalEntry(std::string_view entry)
+    {
+        std::string_view op;
+        std::string_view payload;
+        if (!RosterJournal::ParseEntry(entry, op, payload)) return false;
+
+        if (op == RosterJournal::OP_ADD || op == RosterJournal::OP_UPDATE)
+        {
+            std::shared_ptr<Player> player =
+                PlayerFactory::GetInstance().Create(payload);
+            const std::size_t slot = FindSlot(player->GetPlayerId());
+            if (slot == players_.size())
+                AppendPlayer(std::move(player));
+            else
+            {
+                players_[slot] = std::move(player);
+                placedAt_[slot] = snapshotCount_.load(std::memory_order_relaxed);
+                ReindexPlayer(slot);
+            }
+            return true;
+        }
+
+        if (op == RosterJournal::OP_REMOVE)
+        {
+            const std::size_t slot = FindSlot(RecordParser::ParseInt(payload));
+            if (slot != players_.size())
+                EraseSlot(slot);
+            return true;
+        }
+
+        if (op == RosterJournal::OP_BUDGET)
+        {
+            transferBudget_ = RecordParser::ParseDouble(payload);
+            return true;
+        }
+        return false;
+    }
+
+    std::size_t ClubManager::ReplayJournal(IRecordSource& entries)
+    {
+        const ExclusiveLock lock(*this);
+        std::size_t applied = 0;
+        std::string_view entry;
+        while (entries.NextRecord(entry))
+        {
+            try
+            {
+                if (ApplyJournalEntry(entry))
+                    ++applied;
+                else
+                    std::cout << "[WARNING] Пропущено пошкоджений запис журналу."
+                        << std::endl;
+            }
+            catch (const std::exception& e)
+            {
+                std::cout << "[ERROR] Не вдалося застосувати запис журналу: "
+                    << e.what() << std::endl;
+            }
+        }
+        return applied;
+    }
+
     std::string ClubManager::Serialize() const
     {
-        std::stringstream ss;
-        ss << clubName_ << "," << transferBudget_ << "\n";
+        OutputBuffer out;
+        AppendTo(out);
+        return out.Take();
+    }
+
+    void ClubManager::AppendTo(OutputBuffer& out) const
+    {
+        const auto lock = LockShared();
+        out.Append(clubName_).Append(',').AppendDouble(transferBudget_)
+           .Append(',').AppendInt(GetNextId()).Append('\n');
         for (const auto& p : players_)
-            ss << p->Serialize() << "\n";
-        return ss.str();
+        {
+            p->AppendTo(out);
+            out.Append('\n');
+        }
+    }
+
+    void ClubManager::WriteTo(RecordSink& sink) const
+    {
+        Snapshot().WriteTo(sink);
     }
 
     void ClubManager::Deserialize(const std::string& data)
@@ -202,22 +1283,86 @@ namespace FootballManagement
     void ClubManager::DeserializeAllPlayers(
         const std::vector<std::string>& lines)
     {
-        players_.clear();
+        VectorRecordSource records(lines);
+        DeserializeAllPlayers(records);
+    }
+
+    void ClubManager::DeserializeAllPlayers(IRecordSource& records)
+    {
+        ClubManager staged(StagingTag{}, GetClubName(), GetTransferBudget());
+        staged.LoadRecords(records);
+        if (records.Failed())
+            throw std::runtime_error(
+                "Помилка читання знімка до кінця файлу — склад не змінено.");
+        if (records.Cancelled())
+            throw std::runtime_error(
+                "Читання знімка зупинено до кінця файлу — склад не змінено.");
 
-        if (lines.empty())
+        const ExclusiveLock lock(*this);
+        AdoptRoster(std::move(staged));
+    }
+
+    void ClubManager::LoadRecords(IRecordSource& records)
+    {
+        const std::size_t hint = records.SizeHint();
+        ResetRoster(hint > 1 ? hint - 1 : 0);
+
+        std::string_view header;
+        if (!records.NextRecord(header))
         {
             std::cout << "[WARNING] Порожній файл — гравців не знайдено." <<
                 std::endl;
             return;
         }
+        ApplyHeader(header);
+
+        const auto start = std::chrono::steady_clock::now();
+        const PlayerFactory& factory = PlayerFactory::GetInstance();
+
+        std::size_t total = 0;
+        std::size_t skipped = 0;
+        std::string_view record;
+        while (records.NextRecord(record))
+        {
+            ++total;
+            try
+            {
+                if (!AppendPlayer(factory.Create(record)))
+                {
+                    ++skipped;
+                    std::cout << "[ERROR] Пропущено запис гравця №" << total
+                        << ": повторний ID." << std::endl;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                ++skipped;
+                std::cout << "[ERROR] Пропущено запис гравця №" << total << ": "
+                    << e.what() << std::endl;
+            }
+        }
+
+        ReportLoad(total, skipped, std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count());
+    }
 
+    void ClubManager::ApplyHeader(std::string_view header)
+    {
         try
         {
-            std::stringstream ss(lines[0]);
-            std::string budgetStr;
-            getline(ss, clubName_, ',');
-            if (getline(ss, budgetStr))
-                transferBudget_ = stod(budgetStr);
+            const std::size_t comma = header.find(',');
+            clubName_.assign(header.substr(0, comma));
+            if (comma != std::string_view::npos)
+            {
+                // Старі файли не містять третього поля — тоді послідовність
+                // відновлюється з ID завантажених гравців.
+                const std::size_t idComma = header.find(',', comma + 1);
+                transferBudget_ = RecordParser::ParseDouble(
+                    header.substr(comma + 1, idComma - comma - 1));
+                if (idComma != std::string_view::npos)
+                    ObserveId(RecordParser::ParseInt(
+                        header.substr(idComma + 1)) - 1);
+            }
 
             std::cout << "[INFO] Завантажено дані клубу: " << clubName_
                 << " | Бюджет: " << transferBudget_ << " €." << std::endl;
@@ -227,9 +1372,220 @@ namespace FootballManagement
             std::cout << "[ERROR] Помилка при розборі даних клубу: " << e.what()
                 << std::endl;
         }
+    }
 
-        std::cout <<
-            "[WARNING] Логіка створення гравців при завантаженні поки не реалізована."
-            << std::endl;
+    void ClubManager::ReportLoad(std::size_t total, std::size_t skipped,
+                                 double seconds) const
+    {
+        std::cout << "[INFO] Завантажено гравців: " << players_.size()
+            << " (пропущено: " << skipped << ") за " << seconds << " с";
+        if (seconds > 0.0)
+            std::cout << " | " << static_cast<long long>(total / seconds)
+                << " записів/с";
+        std::cout << "." << std::endl;
+    }
+
+    void ClubManager::DeserializeAllPlayersParallel(std::string_view data,
+                                                    ThreadPool& pool)
+    {
+        ClubManager staged(StagingTag{}, GetClubName(), GetTransferBudget());
+        staged.LoadTextParallel(data, pool);
+
+        const ExclusiveLock lock(*this);
+        AdoptRoster(std::move(staged));
+    }
+
+    void ClubManager::LoadTextParallel(std::string_view data, ThreadPool& pool)
+    {
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+
+        LineRange lines(data);
+        const auto first = lines.begin();
+        if (first == lines.end())
+        {
+            std::cout << "[WARNING] Порожній файл — гравців не знайдено." <<
+                std::endl;
+            return;
+        }
+        const std::string_view header = *first;
+        const std::string_view body = data.substr(
+            static_cast<std::size_t>(header.data() - data.data()) + header.size());
+
+        // Фрагментів більше, ніж потоків: нерівні за вартістю фрагменти
+        // розподіляються між потоками через спільну чергу пулу.
+        constexpr std::size_t MIN_CHUNK_BYTES = 64 * 1024;
+        constexpr std::size_t CHUNKS_PER_THREAD = 8;
+        const std::size_t chunkBytes = std::max(
+            MIN_CHUNK_BYTES, body.size() / (pool.ThreadCount() * CHUNKS_PER_THREAD) + 1);
+
+        // Розібраний фрагмент: по елементу на запис; nullptr — запис з
+        // помилкою, текст якої лежить у errors у тому ж порядку. Іменний
+        // індекс фрагмента (найдорожча частина індексування) будується
+        // тут же, у потоці розбору.
+        struct ParsedChunk
+        {
+            std::vector<std::shared_ptr<Player>> players;
+            std::vector<std::string> errors;
+            NameIndex names;
+        };
+
+        // Рядків не менше, ніж записів: резерв складу й арен гравців робиться
+        // до розбору, щоб потоки не нарощували плити посеред нього.
+        ResetRoster(LineRange(body).SizeHint());
+
+        const PlayerFactory& factory = PlayerFactory::GetInstance();
+        std::vector<std::future<ParsedChunk>> chunks;
+        for (std::size_t begin = 0; begin < body.size();)
+        {
+            const std::size_t end = std::min(
+                body.size(), body.find('\n', std::min(body.size(), begin + chunkBytes)));
+            const std::string_view text = body.substr(begin, end - begin);
+            begin = end + 1;
+
+            chunks.push_back(pool.Submit([text, &factory]
+            {
+                ParsedChunk parsed;
+                for (const std::string_view record : LineRange(text))
+                {
+                    try
+                    {
+                        parsed.players.push_back(factory.Create(record));
+                        // Як і в AppendPlayer, перший запис з ID перемагає.
+                        const Player& player = *parsed.players.back();
+                        if (!parsed.names.Contains(player.GetPlayerId()))
+                            parsed.names.Insert(player.GetPlayerId(),
+                                                player.GetName());
+                    }
+                    catch (const std::exception& e)
+                    {
+                        parsed.players.push_back(nullptr);
+                        parsed.errors.emplace_back(e.what());
+                    }
+                }
+                return parsed;
+            }));
+        }
+
+        // Фрагменти посилаються на data, тож спершу дочікуємося всіх задач.
+        std::vector<ParsedChunk> parsed(chunks.size());
+        std::exception_ptr failure;
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            try
+            {
+                parsed[i] = chunks[i].get();
+                total += parsed[i].players.size();
+            }
+            catch (...)
+            {
+                if (!failure) failure = std::current_exception();
+            }
+        }
+        if (failure) std::rethrow_exception(failure);
+
+        ApplyHeader(header);
+
+        std::size_t recordNumber = 0;
+        std::size_t skipped = 0;
+        for (ParsedChunk& chunk : parsed)
+        {
+            std::size_t error = 0;
+            for (auto& player : chunk.players)
+            {
+                ++recordNumber;
+                if (!player)
+                {
+                    ++skipped;
+                    std::cout << "[ERROR] Пропущено запис гравця №" << recordNumber
+                        << ": " << chunk.errors[error++] << std::endl;
+                }
+                else if (!AppendUnnamed(std::move(player)))
+                {
+                    ++skipped;
+                    std::cout << "[ERROR] Пропущено запис гравця №" << recordNumber
+                        << ": повторний ID." << std::endl;
+                }
+            }
+            nameIndex_.Append(std::move(chunk.names));
+            // Об'єкти фрагмента звільняються одразу після злиття.
+            chunk = ParsedChunk{};
+        }
+
+        ReportLoad(total, skipped,
+                   std::chrono::duration<double>(Clock::now() - start).count());
+    }
+
+    void ClubManager::DeserializeRecords(IRecordSource& records)
+    {
+        DeserializeAllPlayers(records);
+    }
+
+    void ClubManager::DeserializeText(std::string_view data)
+    {
+        DeserializeAllPlayersParallel(data);
+    }
+
+    std::string ClubManager::SerializeBinary() const
+    {
+        // Запис іде зі знімка, тож блокування не тримається під час серіалізації.
+        return Snapshot().SerializeBinary();
+    }
+
+    void ClubManager::DeserializeBinary(std::string_view data)
+    {
+        ClubManager staged(StagingTag{}, GetClubName(), GetTransferBudget());
+        staged.LoadBinary(data);
+
+        const ExclusiveLock lock(*this);
+        AdoptRoster(std::move(staged));
+    }
+
+    void ClubManager::LoadBinary(std::string_view data)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        BinaryReader reader(data);
+        const std::string_view clubName = reader.ReadString();
+        const double budget = reader.ReadF64();
+        const int nextId = reader.Version() >= 2 ? reader.ReadI32() : 0;
+        const std::uint64_t count = reader.ReadU64();
+
+        const PlayerFactory& factory = PlayerFactory::GetInstance();
+        // Кількість береться з файлу, тому резерв обмежено розміром даних:
+        // до складу потрапляють лише записи відомих типів, а кожен з них
+        // займає щонайменше 50 байтів (тег, довжина і поля Player).
+        constexpr std::size_t MIN_PLAYER_RECORD_BYTES = 50;
+        ResetRoster(static_cast<std::size_t>(std::min<std::uint64_t>(
+            count, data.size() / MIN_PLAYER_RECORD_BYTES)));
+        clubName_.assign(clubName);
+        transferBudget_ = budget;
+        ObserveId(nextId - 1);
+
+        std::size_t skipped = 0;
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            const auto tag = static_cast<PlayerRecordTag>(reader.ReadU8());
+            const std::uint32_t length = reader.ReadU32();
+            const std::size_t recordEnd = reader.Position() + length;
+
+            if (std::shared_ptr<Player> player = factory.Create(tag))
+            {
+                player->ReadBinary(reader);
+                if (!AppendPlayer(std::move(player))) ++skipped;
+            }
+            else
+            {
+                ++skipped;
+            }
+            reader.Seek(recordEnd);
+        }
+
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        std::cout << "[INFO] Завантажено клуб " << clubName_
+            << " з бінарного знімка: " << players_.size()
+            << " гравців (пропущено: " << skipped << ") за " << seconds
+            << " с." << std::endl;
     }
 }
@@ -1,4 +1,6 @@
 #include "../include/ContractDetails.h"
+#include "../include/BinaryIO.h"
+#include "../include/RecordParser.h"
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -169,4 +171,57 @@ namespace FootballManagement
             std::cout << " (Оренда до: " << loanEndDate_ << ")";
         std::cout << std::endl;
     }
+
+    std::string ContractDetails::Serialize() const
+    {
+        OutputBuffer out;
+        AppendTo(out);
+        return out.Take();
+    }
+
+    void ContractDetails::AppendTo(OutputBuffer& out) const
+    {
+        out.AppendKey("club").AppendQuoted(clubName_).Append(',')
+           .AppendKey("salary").AppendDouble(salary_).Append(',')
+           .AppendKey("contractUntil").AppendQuoted(contractUntil_).Append(',')
+           .AppendKey("onLoan").AppendBool(isLoaned_).Append(',')
+           .AppendKey("loanEnd").AppendQuoted(loanEndDate_);
+    }
+
+    bool ContractDetails::DeserializeField(std::uint64_t keyHash,
+                                           std::string_view value)
+    {
+        switch (keyHash)
+        {
+        case HashKey("club"): clubName_.assign(value);
+            return true;
+        case HashKey("salary"): salary_ = RecordParser::ParseDouble(value);
+            return true;
+        case HashKey("contractUntil"): contractUntil_.assign(value);
+            return true;
+        case HashKey("onLoan"): isLoaned_ = RecordParser::ParseBool(value);
+            return true;
+        case HashKey("loanEnd"): loanEndDate_.assign(value);
+            return true;
+        default: return false;
+        }
+    }
+
+    void ContractDetails::WriteBinary(BinaryWriter& writer) const
+    {
+        writer.WriteString(clubName_);
+        writer.WriteF64(salary_);
+        writer.WriteString(contractUntil_);
+        writer.WriteBool(isLoaned_);
+        writer.WriteString(loanEndDate_);
+    }
+
+    void ContractDetails::ReadBinary(BinaryReader& reader)
+    {
+        clubName_.assign(reader.ReadString());
+        salary_ = reader.ReadF64();
+        contractUntil_.assign(reader.ReadString());
+        isLoaned_ = reader.ReadBool();
+        loanEndDate_.assign(reader.ReadString());
+    }
 }
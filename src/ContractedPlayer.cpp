@@ -1,4 +1,8 @@
 #include "../include/ContractedPlayer.h"
+#include "../include/BinaryIO.h"
+#include "../include/RecordParser.h"
+#include "../include/RosterColumns.h"
+#include "../include/SlabPool.h"
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
@@ -16,7 +20,7 @@ namespace FootballManagement
 
     ContractedPlayer::ContractedPlayer(const std::string& name, int age,
                                        const std::string& nationality,
-                                       std::string& origin,
+                                       const std::string& origin,
                                        double height,
                                        double weight,
                                        double marketValue,
@@ -157,6 +161,16 @@ namespace FootballManagement
             << "\" за " << fee << " €." << std::endl;
     }
 
+    double ContractedPlayer::GetSalary() const
+    {
+        return contract_details_.GetSalary();
+    }
+
+    void ContractedPlayer::AdjustSalary(double percentageChange)
+    {
+        contract_details_.AdjustSalary(percentageChange);
+    }
+
     void ContractedPlayer::ExtendedContract(const std::string& newDate,
                                           double newSalary)
     {
@@ -210,9 +224,14 @@ namespace FootballManagement
     }
 
     double ContractedPlayer::CalculateValue() const
+    {
+        return ValueFormula(CalculatePerformanceRating());
+    }
+
+    double ContractedPlayer::ValueFormula(double rating) const
     {
         double baseValue = GetMarketValue();
-        double performanceBonus = CalculatePerformanceRating() * 50000.0;
+        double performanceBonus = rating * 50000.0;
         double salaryImpact = contract_details_.GetSalary() / 10000.0;
 
         return baseValue + performanceBonus + salaryImpact;
@@ -220,11 +239,16 @@ namespace FootballManagement
 
     std::string ContractedPlayer::GetStatus() const
     {
-        if (IsInjured())
-            return "Травмований гравець";
-        if (contract_details_.IsPlayerOnLoan())
-            return "В оренді";
-        return "Активний гравець";
+        return std::string(DescribeStatus(GetStatusFlags()));
+    }
+
+    PlayerStatus ContractedPlayer::GetStatusFlags() const
+    {
+        PlayerStatus flags = FieldPlayer::GetStatusFlags() |
+            PlayerStatus::Contracted;
+        if (contract_details_.IsPlayerOnLoan()) flags |= PlayerStatus::OnLoan;
+        if (listedForTransfer_) flags |= PlayerStatus::ListedForTransfer;
+        return flags;
     }
 
     void ContractedPlayer::CelebrateBirthday()
@@ -239,28 +263,98 @@ namespace FootballManagement
     }
 
     double ContractedPlayer::CalculatePerformanceRating() const
+    {
+        return RatingFormula();
+    }
+
+    double ContractedPlayer::RatingFormula() const
     {
         return 0.0;
     }
 
-    std::string ContractedPlayer::Serialize() const
+    void ContractedPlayer::RateBatch(
+        std::span<const ContractedPlayer* const> players, std::span<double> out)
+    {
+        for (std::size_t i = 0; i < players.size(); ++i)
+            out[i] = players[i]->RatingFormula();
+    }
+
+    void ContractedPlayer::ValueBatch(
+        std::span<const ContractedPlayer* const> players, std::span<double> out)
+    {
+        for (std::size_t i = 0; i < players.size(); ++i)
+            out[i] = players[i]->ValueFormula(players[i]->RatingFormula());
+    }
+
+    void ContractedPlayer::AppendTo(OutputBuffer& out) const
     {
-        std::stringstream ss;
-        ss << FieldPlayer::Serialize()
-            << "," << contract_details_.GetClubName()
-            << "," << contract_details_.GetSalary()
-            << "," << contract_details_.GetContractUntil()
-            << "," << listedForTransfer_
-            << "," << transferFee_
-            << "," << transferConditions_;
-        return ss.str();
+        out.AppendKey(PLAYER_TYPE_KEY).AppendQuoted(CONTRACTED_PLAYER_TYPE_TAG)
+           .Append(',');
+        FieldPlayer::AppendTo(out);
+        out.Append(',');
+        contract_details_.AppendTo(out);
+        out.Append(',')
+           .AppendKey("listed").AppendBool(listedForTransfer_).Append(',')
+           .AppendKey("transferFee").AppendDouble(transferFee_).Append(',')
+           .AppendKey("conditions").AppendQuoted(transferConditions_);
     }
 
     void ContractedPlayer::Deserialize(const std::string& data)
     {
-        FieldPlayer::Deserialize(data);
-        std::cout <<
-            "[WARNING] Логіка десеріалізації ContractedPlayer ще не реалізована."
-            << std::endl;
+        Player::DeserializeBase(data);
+    }
+
+    bool ContractedPlayer::DeserializeField(std::uint64_t keyHash,
+                                            std::string_view value)
+    {
+        switch (keyHash)
+        {
+        case HashKey("listed"):
+            listedForTransfer_ = RecordParser::ParseBool(value);
+            return true;
+        case HashKey("transferFee"):
+            transferFee_ = RecordParser::ParseDouble(value);
+            return true;
+        case HashKey("conditions"): transferConditions_.assign(value);
+            return true;
+        default:
+            return contract_details_.DeserializeField(keyHash, value) ||
+                FieldPlayer::DeserializeField(keyHash, value);
+        }
+    }
+
+    std::shared_ptr<Player> ContractedPlayer::Clone() const
+    {
+        RequireExactType(typeid(ContractedPlayer));
+        return MakePooled<ContractedPlayer>(*this);
+    }
+
+    PlayerRecordTag ContractedPlayer::GetRecordTag() const
+    {
+        return PlayerRecordTag::ContractedPlayer;
+    }
+
+    void ContractedPlayer::WriteBinary(BinaryWriter& writer) const
+    {
+        FieldPlayer::WriteBinary(writer);
+        contract_details_.WriteBinary(writer);
+        writer.WriteBool(listedForTransfer_);
+        writer.WriteF64(transferFee_);
+        writer.WriteString(transferConditions_);
+    }
+
+    void ContractedPlayer::ReadBinary(BinaryReader& reader)
+    {
+        FieldPlayer::ReadBinary(reader);
+        contract_details_.ReadBinary(reader);
+        listedForTransfer_ = reader.ReadBool();
+        transferFee_ = reader.ReadF64();
+        transferConditions_.assign(reader.ReadString());
+    }
+
+    void ContractedPlayer::WriteColumns(RosterRow& row) const
+    {
+        FieldPlayer::WriteColumns(row);
+        row.Double(RosterColumn::Salary) = GetSalary();
     }
 }
@@ -0,0 +1,120 @@
+#include "../include/DurableFile.h"
+#include <cerrno>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define FM_HAS_FSYNC 1
+#endif
+
+namespace FootballManagement
+{
+    DurableFile::DurableFile() : fd_(-1)
+    {
+    }
+
+    DurableFile::DurableFile(const std::string& fullPath, Mode mode) : fd_(-1)
+    {
+        Open(fullPath, mode);
+    }
+
+    DurableFile::~DurableFile() noexcept
+    {
+#ifdef FM_HAS_FSYNC
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    void DurableFile::Open(const std::string& fullPath, Mode mode)
+    {
+#ifdef FM_HAS_FSYNC
+        if (fd_ >= 0) ::close(fd_);
+        const int flags = O_WRONLY | O_CREAT | O_CLOEXEC |
+            (mode == Mode::Append ? O_APPEND : O_TRUNC);
+        fd_ = ::open(fullPath.c_str(), flags, 0644);
+        if (fd_ < 0)
+            throw std::runtime_error("Не вдалося відкрити файл для запису.");
+#else
+        if (fallback_.is_open()) fallback_.close();
+        fallback_.clear();
+        fallback_.open(fullPath, std::ios::out | std::ios::binary |
+                       (mode == Mode::Append ? std::ios::app : std::ios::trunc));
+        if (!fallback_.is_open())
+            throw std::runtime_error("Не вдалося відкрити файл для запису.");
+#endif
+    }
+
+    bool DurableFile::IsOpen() const
+    {
+#ifdef FM_HAS_FSYNC
+        return fd_ >= 0;
+#else
+        return fallback_.is_open();
+#endif
+    }
+
+    void DurableFile::Write(std::string_view data)
+    {
+#ifdef FM_HAS_FSYNC
+        while (!data.empty())
+        {
+            const ssize_t written = ::write(fd_, data.data(), data.size());
+            if (written < 0)
+            {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("Не вдалося записати дані.");
+            }
+            data.remove_prefix(static_cast<std::size_t>(written));
+        }
+#else
+        fallback_.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!fallback_)
+            throw std::runtime_error("Не вдалося записати дані.");
+#endif
+    }
+
+    void DurableFile::Sync()
+    {
+#ifdef FM_HAS_FSYNC
+        if (::fsync(fd_) != 0)
+            throw std::runtime_error("Не вдалося скинути дані на диск.");
+#else
+        fallback_.flush();
+        if (!fallback_)
+            throw std::runtime_error("Не вдалося скинути дані на диск.");
+#endif
+    }
+
+    void DurableFile::Close()
+    {
+#ifdef FM_HAS_FSYNC
+        if (fd_ < 0) return;
+        const int result = ::close(fd_);
+        fd_ = -1;
+        if (result != 0)
+            throw std::runtime_error("Не вдалося записати дані.");
+#else
+        if (!fallback_.is_open()) return;
+        fallback_.close();
+        if (!fallback_)
+            throw std::runtime_error("Не вдалося записати дані.");
+#endif
+    }
+
+    void DurableFile::SyncDirectory(const std::string& directoryPath)
+    {
+#ifdef FM_HAS_FSYNC
+        const std::string path = directoryPath.empty() ? "." : directoryPath;
+        const int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("Не вдалося відкрити каталог даних.");
+        const int result = ::fsync(fd);
+        ::close(fd);
+        if (result != 0)
+            throw std::runtime_error("Не вдалося скинути каталог даних на диск.");
+#else
+        (void)directoryPath;
+#endif
+    }
+}
@@ -1,6 +1,10 @@
 #include "../include/FieldPlayer.h"
+#include "../include/BinaryIO.h"
+#include "../include/RecordParser.h"
+#include "../include/RosterColumns.h"
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <stdexcept>
 #include <utility>
 
@@ -160,8 +164,6 @@ namespace FootballManagement
                   << CalculateConversionRate() << "%" << std::endl;
     }
 
-    void SetAge(int newAge);
-
     void FieldPlayer::CelebrateBirthday()
     {
         int newAge = GetAge() + 1;
@@ -170,4 +172,81 @@ namespace FootballManagement
         std::cout << "[INFO] З днем народження, " << GetName()
                   << "! Тепер вам " << newAge << " років. "
                   << "Бажаємо нових перемог!" << std::endl;}
+
+    void FieldPlayer::AppendTo(OutputBuffer& out) const
+    {
+        Player::AppendTo(out);
+        out.Append(',')
+           .AppendKey("games").AppendInt(totalGames_).Append(',')
+           .AppendKey("goals").AppendInt(totalGoals_).Append(',')
+           .AppendKey("assists").AppendInt(totalAssists_).Append(',')
+           .AppendKey("shots").AppendInt(totalShots_).Append(',')
+           .AppendKey("tackles").AppendInt(totalTackles_).Append(',')
+           .AppendKey("keyPasses").AppendInt(keyPasses_).Append(',')
+           .AppendKey("position").AppendInt(static_cast<int>(position_));
+    }
+
+    void FieldPlayer::Deserialize(const std::string& data)
+    {
+        Player::DeserializeBase(data);
+    }
+
+    bool FieldPlayer::DeserializeField(std::uint64_t keyHash,
+                                       std::string_view value)
+    {
+        switch (keyHash)
+        {
+        case HashKey("games"): totalGames_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("goals"): totalGoals_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("assists"): totalAssists_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("shots"): totalShots_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("tackles"): totalTackles_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("keyPasses"): keyPasses_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("position"):
+            position_ = static_cast<Position>(RecordParser::ParseInt(value));
+            return true;
+        default: return Player::DeserializeField(keyHash, value);
+        }
+    }
+
+    void FieldPlayer::WriteBinary(BinaryWriter& writer) const
+    {
+        Player::WriteBinary(writer);
+        writer.WriteI32(totalGames_);
+        writer.WriteI32(totalGoals_);
+        writer.WriteI32(totalAssists_);
+        writer.WriteI32(totalShots_);
+        writer.WriteI32(totalTackles_);
+        writer.WriteI32(keyPasses_);
+        writer.WriteU8(static_cast<std::uint8_t>(position_));
+    }
+
+    void FieldPlayer::ReadBinary(BinaryReader& reader)
+    {
+        Player::ReadBinary(reader);
+        totalGames_ = reader.ReadI32();
+        totalGoals_ = reader.ReadI32();
+        totalAssists_ = reader.ReadI32();
+        totalShots_ = reader.ReadI32();
+        totalTackles_ = reader.ReadI32();
+        keyPasses_ = reader.ReadI32();
+        position_ = static_cast<Position>(reader.ReadU8());
+    }
+
+    void FieldPlayer::WriteColumns(RosterRow& row) const
+    {
+        Player::WriteColumns(row);
+        row.Int(RosterColumn::Games) = totalGames_;
+        row.Int(RosterColumn::Goals) = totalGoals_;
+        row.Int(RosterColumn::Assists) = totalAssists_;
+        row.Int(RosterColumn::Shots) = totalShots_;
+        row.Int(RosterColumn::Tackles) = totalTackles_;
+        row.Int(RosterColumn::KeyPasses) = keyPasses_;
+    }
 }
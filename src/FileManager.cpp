@@ -1,4 +1,6 @@
 #include "../include/FileManager.h"
+#include "../include/BinaryIO.h"
+#include "../include/DurableFile.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -18,7 +20,7 @@ namespace FootballManagement
     {
         try
         {
-            if (!fs::std::exists(directoryPath_))
+            if (!fs::exists(directoryPath_))
             {
                 fs::create_directories(directoryPath_);
                 std::cout << "[ІНФО] Створено каталог даних: " << directoryPath_
@@ -39,34 +41,196 @@ namespace FootballManagement
         return fs::exists(GetFullPath(fileName));
     }
 
-    bool FileManager::SaveToFile(const std::string& fileName,
-                                 const IFileHandler& serializableObject) const
+    bool FileManager::WriteAtomically(
+        const std::string& fileName,
+        const std::function<void(RecordSink&)>& write) const
     {
         if (!EnsureDirectoryExists()) return false;
 
-        std::string fullPath = GetFullPath(fileName);
-        std::ofstream file(fullPath);
+        // Дані пишуться у тимчасовий файл, який потім атомарно замінює
+        // цільовий: збій посеред запису не пошкоджує попередню версію.
+        const std::string fullPath = GetFullPath(fileName);
+        const std::string tempPath = fullPath + ".tmp";
 
         try
         {
-            if (!file.is_open())
             {
-                throw std::runtime_error(
-                    "Не вдалося відкрити файл для запису.");
+                FileRecordSink sink(tempPath, flushBytes_);
+                write(sink);
+                sink.Close();
             }
 
-            string data = serializableObject.Serialize();
-            file.close();
+            // Close() уже скинув вміст на диск; скидання каталогу фіксує
+            // саме перейменування, інакше після збою може лишитися стара версія.
+            fs::rename(tempPath, fullPath);
+            DurableFile::SyncDirectory(fs::path(fullPath).parent_path().string());
             return true;
         }
         catch (const std::exception& e)
         {
             std::cout << "[ПОМИЛКА] Не вдалося зберегти дані у файл " <<
                 fileName << ": " << e.what() << std::endl;
+            std::error_code ignored;
+            fs::remove(tempPath, ignored);
             return false;
         }
     }
 
+    bool FileManager::WriteAtomically(const std::string& fileName,
+                                      std::string_view data) const
+    {
+        return WriteAtomically(fileName, [data](RecordSink& sink)
+        {
+            sink.Write(data);
+        });
+    }
+
+    bool FileManager::SaveToFile(const std::string& fileName,
+                                 const IFileHandler& serializableObject) const
+    {
+        try
+        {
+            return WriteAtomically(fileName, [&serializableObject](RecordSink& sink)
+            {
+                serializableObject.WriteTo(sink);
+            });
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося зберегти дані у файл " <<
+                fileName << ": " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    void FileManager::SetFlushBytes(std::size_t flushBytes)
+    {
+        flushBytes_ = flushBytes;
+    }
+
+    std::size_t FileManager::GetFlushBytes() const
+    {
+        return flushBytes_;
+    }
+
+    void FileManager::SetSnapshotFormat(SnapshotFormat format)
+    {
+        snapshotFormat_ = format;
+    }
+
+    SnapshotFormat FileManager::GetSnapshotFormat() const
+    {
+        return snapshotFormat_;
+    }
+
+    bool FileManager::SaveSnapshot(const std::string& fileName,
+                                   const ISnapshotHandler& snapshot) const
+    {
+        if (snapshotFormat_ == SnapshotFormat::Text)
+            return SaveToFile(fileName, snapshot);
+
+        try
+        {
+            return WriteAtomically(fileName, snapshot.SerializeBinary());
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося зберегти бінарний знімок " <<
+                fileName << ": " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    bool FileManager::SaveSnapshot(const std::string& fileName,
+                                   const RosterSnapshot& roster) const
+    {
+        if (snapshotFormat_ == SnapshotFormat::Text)
+            return WriteAtomically(fileName, [&roster](RecordSink& sink)
+            {
+                roster.WriteTo(sink);
+            });
+
+        try
+        {
+            return WriteAtomically(fileName, roster.SerializeBinary());
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося зберегти бінарний знімок " <<
+                fileName << ": " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    bool FileManager::LoadSnapshot(const std::string& fileName,
+                                   ISnapshotHandler& snapshot) const
+    {
+        try
+        {
+            RecordReader records = ReadRecords(fileName);
+            if (records.Failed()) return false;
+
+            // Відображення відкривається напряму: помилка MapFile дала б
+            // порожні дані, тобто порожній склад замість невдачі.
+            if (BinaryReader::HasMagic(records.Peek()))
+            {
+                // Бінарний формат розбирається з цілого відображення файлу.
+                const MappedFile file(GetFullPath(fileName));
+                snapshot.DeserializeBinary(file.Data());
+                return true;
+            }
+
+            if (parallelLoad_ && !records.Peek().empty())
+            {
+                const MappedFile file(GetFullPath(fileName));
+                snapshot.DeserializeText(file.Data());
+                return true;
+            }
+
+            try
+            {
+                snapshot.DeserializeRecords(records);
+            }
+            catch (const std::exception&)
+            {
+                if (!records.Cancelled()) throw;
+                std::cout << "[ПОПЕРЕДЖЕННЯ] Завантаження " << fileName <<
+                    " зупинено після " << records.Progress().records <<
+                    " записів; дані не змінено." << std::endl;
+                return false;
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося прочитати знімок " << fileName <<
+                ": " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    bool FileManager::ConvertSnapshot(const std::string& sourceFile,
+                                      const std::string& targetFile,
+                                      SnapshotFormat targetFormat,
+                                      ISnapshotHandler& buffer) const
+    {
+        if (!FileExists(sourceFile))
+        {
+            std::cout << "[ПОМИЛКА] Неможливо конвертувати: " << sourceFile <<
+                " не знайдено." << std::endl;
+            return false;
+        }
+        if (!LoadSnapshot(sourceFile, buffer)) return false;
+
+        FileManager target = *this;
+        target.SetSnapshotFormat(targetFormat);
+        if (!target.SaveSnapshot(targetFile, buffer)) return false;
+
+        std::cout << "[ІНФО] Знімок " << sourceFile << " конвертовано у " <<
+            targetFile << "." << std::endl;
+        return true;
+    }
+
     std::vector<std::string> FileManager::LoadFromFile(
         const std::string& fileName) const
     {
@@ -79,14 +243,14 @@ namespace FootballManagement
             return lines;
         }
 
-        std::string FullPath = GetFullPath(fileName);
+        std::string fullPath = GetFullPath(fileName);
         std::ifstream file(fullPath);
 
         try
         {
             if (!file.is_open())
             {
-                throw runtime_error("Не вдалося відкрити файл для читання.");
+                throw std::runtime_error("Не вдалося відкрити файл для читання.");
             }
 
             std::string line;
@@ -101,7 +265,7 @@ namespace FootballManagement
             file.close();
             return lines;
         }
-        catch (const exception& e)
+        catch (const std::exception& e)
         {
             std::cout << "[ПОМИЛКА] Не вдалося прочитати дані з " << fileName <<
                 ": " << e.what() << std::endl;
@@ -109,6 +273,74 @@ namespace FootballManagement
         }
     }
 
+    void FileManager::SetReadBufferBytes(std::size_t bufferBytes)
+    {
+        readBufferBytes_ = bufferBytes;
+    }
+
+    std::size_t FileManager::GetReadBufferBytes() const
+    {
+        return readBufferBytes_;
+    }
+
+    void FileManager::SetReadProgressCallback(ReadProgressCallback onProgress)
+    {
+        onReadProgress_ = std::move(onProgress);
+    }
+
+    void FileManager::SetParallelLoad(bool enabled)
+    {
+        parallelLoad_ = enabled;
+    }
+
+    bool FileManager::IsParallelLoad() const
+    {
+        return parallelLoad_;
+    }
+
+    RecordReader FileManager::ReadRecords(const std::string& fileName) const
+    {
+        if (!FileExists(fileName))
+        {
+            std::cout << "[ПОПЕРЕДЖЕННЯ] Файл не знайдено: " << fileName <<
+                ". Повертається порожній набір даних." << std::endl;
+            return {};
+        }
+
+        try
+        {
+            return RecordReader(GetFullPath(fileName), readBufferBytes_,
+                                onReadProgress_);
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося відкрити файл " << fileName <<
+                ": " << e.what() << std::endl;
+            return RecordReader::Unreadable();
+        }
+    }
+
+    MappedFile FileManager::MapFile(const std::string& fileName) const
+    {
+        if (!FileExists(fileName))
+        {
+            std::cout << "[ПОПЕРЕДЖЕННЯ] Файл не знайдено: " << fileName <<
+                ". Повертається порожній набір даних." << std::endl;
+            return {};
+        }
+
+        try
+        {
+            return MappedFile(GetFullPath(fileName));
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося відобразити файл " << fileName <<
+                ": " << e.what() << std::endl;
+            return {};
+        }
+    }
+
     void FileManager::DisplayFileContent(const std::string& fileName) const
     {
         // 2.2 Порожні рядки: перед ізольованою в логічному сенсі частиною коду
@@ -136,7 +368,7 @@ namespace FootballManagement
         try
         {
             // 2.3 Пробіли: перед круглими дужками
-            if (fs::std::remove(fullPath))
+            if (fs::remove(fullPath))
             {
                 std::cout << "[ІНФО] Файл успішно видалено: " << fileName <<
                     std::endl;
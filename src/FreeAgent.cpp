@@ -1,4 +1,8 @@
 #include "../include/FreeAgent.h"
+#include "../include/BinaryIO.h"
+#include "../include/RecordParser.h"
+#include "../include/RosterColumns.h"
+#include "../include/SlabPool.h"
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
@@ -97,7 +101,7 @@ namespace FootballManagement
 
     int FreeAgent::GetMonthWithoutClub() const { return monthsWithoutClub_; }
 
-    void FreeAgent::SetLastClub(std::string& lastClub) { lastClub_ = lastClub; }
+    void FreeAgent::SetLastClub(const std::string& lastClub) { lastClub_ = lastClub; }
 
     void FreeAgent::SetMonthWithoutClub(int months)
     {
@@ -184,6 +188,11 @@ namespace FootballManagement
     }
 
     double FreeAgent::CalculateValue() const
+    {
+        return ValueFormula();
+    }
+
+    double FreeAgent::ValueFormula() const
     {
         double penalty = 1.0 - (monthsWithoutClub_ * 0.05);
         penalty = std::max(0.5, penalty);
@@ -192,9 +201,15 @@ namespace FootballManagement
 
     std::string FreeAgent::GetStatus() const
     {
-        if (IsInjured()) return "Травмований вільний агент";
-        if (!availableForNegotiation_) return "Контракт підписано";
-        return "Вільний агент (активний)";
+        return std::string(DescribeStatus(GetStatusFlags()));
+    }
+
+    PlayerStatus FreeAgent::GetStatusFlags() const
+    {
+        PlayerStatus flags = FieldPlayer::GetStatusFlags() |
+            PlayerStatus::FreeAgent;
+        if (!availableForNegotiation_) flags |= PlayerStatus::ContractSigned;
+        return flags;
     }
 
     void FreeAgent::CelebrateBirthday()
@@ -207,24 +222,98 @@ namespace FootballManagement
     }
 
     double FreeAgent::CalculatePerformanceRating() const
+    {
+        return RatingFormula();
+    }
+
+    double FreeAgent::RatingFormula() const
     {
         double rating = 70.0 - (monthsWithoutClub_ * 1.2);
         return std::max(40.0, rating);
     }
 
-    std::string FreeAgent::Serialize() const
+    void FreeAgent::RateBatch(std::span<const FreeAgent* const> players,
+                              std::span<double> out)
     {
-        std::stringstream ss;
-        ss << FieldPlayer::Serialize() << ","
-           << expectedSalary_ << "," << lastClub_ << ","
-           << monthsWithoutClub_ << "," << availableForNegotiation_;
-        return ss.str();
+        for (std::size_t i = 0; i < players.size(); ++i)
+            out[i] = players[i]->RatingFormula();
+    }
+
+    void FreeAgent::ValueBatch(std::span<const FreeAgent* const> players,
+                               std::span<double> out)
+    {
+        for (std::size_t i = 0; i < players.size(); ++i)
+            out[i] = players[i]->ValueFormula();
+    }
+
+    void FreeAgent::AppendTo(OutputBuffer& out) const
+    {
+        out.AppendKey(PLAYER_TYPE_KEY).AppendQuoted(FREE_AGENT_TYPE_TAG).Append(',');
+        FieldPlayer::AppendTo(out);
+        out.Append(',')
+           .AppendKey("expectedSalary").AppendDouble(expectedSalary_).Append(',')
+           .AppendKey("lastClub").AppendQuoted(lastClub_).Append(',')
+           .AppendKey("monthsWithoutClub").AppendInt(monthsWithoutClub_).Append(',')
+           .AppendKey("available").AppendBool(availableForNegotiation_);
     }
 
     void FreeAgent::Deserialize(const std::string& data)
     {
-        FieldPlayer::Deserialize(data);
-        std::cout << "[WARNING] Десеріалізація FreeAgent ще не реалізована." << std::endl;
+        Player::DeserializeBase(data);
+    }
+
+    bool FreeAgent::DeserializeField(std::uint64_t keyHash,
+                                     std::string_view value)
+    {
+        switch (keyHash)
+        {
+        case HashKey("expectedSalary"):
+            expectedSalary_ = RecordParser::ParseDouble(value);
+            return true;
+        case HashKey("lastClub"): lastClub_.assign(value);
+            return true;
+        case HashKey("monthsWithoutClub"):
+            monthsWithoutClub_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("available"):
+            availableForNegotiation_ = RecordParser::ParseBool(value);
+            return true;
+        default: return FieldPlayer::DeserializeField(keyHash, value);
+        }
+    }
+
+    std::shared_ptr<Player> FreeAgent::Clone() const
+    {
+        RequireExactType(typeid(FreeAgent));
+        return MakePooled<FreeAgent>(*this);
+    }
 
+    PlayerRecordTag FreeAgent::GetRecordTag() const
+    {
+        return PlayerRecordTag::FreeAgent;
+    }
+
+    void FreeAgent::WriteBinary(BinaryWriter& writer) const
+    {
+        FieldPlayer::WriteBinary(writer);
+        writer.WriteF64(expectedSalary_);
+        writer.WriteString(lastClub_);
+        writer.WriteI32(monthsWithoutClub_);
+        writer.WriteBool(availableForNegotiation_);
+    }
+
+    void FreeAgent::ReadBinary(BinaryReader& reader)
+    {
+        FieldPlayer::ReadBinary(reader);
+        expectedSalary_ = reader.ReadF64();
+        lastClub_.assign(reader.ReadString());
+        monthsWithoutClub_ = reader.ReadI32();
+        availableForNegotiation_ = reader.ReadBool();
+    }
+
+    void FreeAgent::WriteColumns(RosterRow& row) const
+    {
+        FieldPlayer::WriteColumns(row);
+        row.Int(RosterColumn::MonthsWithoutClub) = monthsWithoutClub_;
     }
 }
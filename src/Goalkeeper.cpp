@@ -1,4 +1,8 @@
 #include "../include/Goalkeepeer.h"
+#include "../include/BinaryIO.h"
+#include "../include/RecordParser.h"
+#include "../include/RosterColumns.h"
+#include "../include/SlabPool.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -84,11 +88,8 @@ namespace FootballManagement
     }
 
     int Goalkeeper::GetMatchesPlayed() const { return matchesPlayed_; }
-    int Goalkeeper::GetCleanSheets() const { return savesTotal_; }
-
-    void Goalkeeper::GetSavesTotal()
-    {
-    }
+    int Goalkeeper::GetCleanSheets() const { return cleanSheets_; }
+    int Goalkeeper::GetSavesTotal() const { return savesTotal_; }
 
     int Goalkeeper::GetGoalsConceded() const { return goalsConceded_; }
     int Goalkeeper::GetPenaltiesSaved() const { return penaltiesSaved_; }
@@ -156,6 +157,11 @@ namespace FootballManagement
     }
 
     double Goalkeeper::CalculatePerformanceRating() const
+    {
+        return RatingFormula();
+    }
+
+    double Goalkeeper::RatingFormula() const
     {
         if (matchesPlayed_ == 0) return 0.0;
 
@@ -168,19 +174,43 @@ namespace FootballManagement
     }
 
     double Goalkeeper::CalculateValue() const
+    {
+        return ValueFormula(CalculatePerformanceRating());
+    }
+
+    double Goalkeeper::ValueFormula(double rating) const
     {
         double baseValue = GetMarketValue();
-        double performanceBonus = CalculatePerformanceRating() * 100000.0;
+        double performanceBonus = rating * 100000.0;
         double cleanSheetBonus = cleanSheets_ * 300000.0;
         return baseValue + performanceBonus + cleanSheetBonus;
     }
 
+    void Goalkeeper::RateBatch(std::span<const Goalkeeper* const> players,
+                               std::span<double> out)
+    {
+        for (std::size_t i = 0; i < players.size(); ++i)
+            out[i] = players[i]->RatingFormula();
+    }
+
+    void Goalkeeper::ValueBatch(std::span<const Goalkeeper* const> players,
+                                std::span<double> out)
+    {
+        for (std::size_t i = 0; i < players.size(); ++i)
+            out[i] = players[i]->ValueFormula(players[i]->RatingFormula());
+    }
+
     std::string Goalkeeper::GetStatus() const
     {
-      return IsInjured() ? "Травмований воротар" : "Активний воротар";
+        return std::string(DescribeStatus(GetStatusFlags()));
     }
 
-    void SetAge(int newAge);
+    PlayerStatus Goalkeeper::GetStatusFlags() const
+    {
+        return Player::GetStatusFlags() | PlayerStatus::Goalkeeper;
+    }
+
+    Position Goalkeeper::GetPosition() const { return Position::Goalkeeper; }
 
     void Goalkeeper::CelebrateBirthday()
     {
@@ -190,22 +220,82 @@ namespace FootballManagement
                   << "! Тепер вам " << newAge << " років." << std::endl;
     }
 
-    std::string Goalkeeper::Serialize() const
+    void Goalkeeper::AppendTo(OutputBuffer& out) const
     {
-       std::stringstream ss;
-      ss << Player::Serialize()
-         << "," << matchesPlayed_
-         << "," << cleanSheets_
-         << "," << savesTotal_
-         << "," << goalsConceded_
-         << "," << penaltiesSaved_;
-      return ss.str();
+        out.AppendKey(PLAYER_TYPE_KEY).AppendQuoted(GOALKEEPER_TYPE_TAG).Append(',');
+        Player::AppendTo(out);
+        out.Append(',')
+           .AppendKey("matches").AppendInt(matchesPlayed_).Append(',')
+           .AppendKey("cleanSheets").AppendInt(cleanSheets_).Append(',')
+           .AppendKey("saves").AppendInt(savesTotal_).Append(',')
+           .AppendKey("conceded").AppendInt(goalsConceded_).Append(',')
+           .AppendKey("penaltiesSaved").AppendInt(penaltiesSaved_);
     }
 
     void Goalkeeper::Deserialize(const std::string& data)
     {
         Player::DeserializeBase(data);
-        std::cout << "[WARNING] Логіка повного розбору даних воротаря ще не реалізована."
-                  << std::endl;
+    }
+
+    bool Goalkeeper::DeserializeField(std::uint64_t keyHash,
+                                      std::string_view value)
+    {
+        switch (keyHash)
+        {
+        case HashKey("matches"): matchesPlayed_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("cleanSheets"):
+            cleanSheets_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("saves"): savesTotal_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("conceded"): goalsConceded_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("penaltiesSaved"):
+            penaltiesSaved_ = RecordParser::ParseInt(value);
+            return true;
+        default: return Player::DeserializeField(keyHash, value);
+        }
+    }
+
+    std::shared_ptr<Player> Goalkeeper::Clone() const
+    {
+        RequireExactType(typeid(Goalkeeper));
+        return MakePooled<Goalkeeper>(*this);
+    }
+
+    PlayerRecordTag Goalkeeper::GetRecordTag() const
+    {
+        return PlayerRecordTag::Goalkeeper;
+    }
+
+    void Goalkeeper::WriteBinary(BinaryWriter& writer) const
+    {
+        Player::WriteBinary(writer);
+        writer.WriteI32(matchesPlayed_);
+        writer.WriteI32(cleanSheets_);
+        writer.WriteI32(savesTotal_);
+        writer.WriteI32(goalsConceded_);
+        writer.WriteI32(penaltiesSaved_);
+    }
+
+    void Goalkeeper::ReadBinary(BinaryReader& reader)
+    {
+        Player::ReadBinary(reader);
+        matchesPlayed_ = reader.ReadI32();
+        cleanSheets_ = reader.ReadI32();
+        savesTotal_ = reader.ReadI32();
+        goalsConceded_ = reader.ReadI32();
+        penaltiesSaved_ = reader.ReadI32();
+    }
+
+    void Goalkeeper::WriteColumns(RosterRow& row) const
+    {
+        Player::WriteColumns(row);
+        row.Int(RosterColumn::MatchesPlayed) = matchesPlayed_;
+        row.Int(RosterColumn::Saves) = savesTotal_;
+        row.Int(RosterColumn::CleanSheets) = cleanSheets_;
+        row.Int(RosterColumn::GoalsConceded) = goalsConceded_;
+        row.Int(RosterColumn::PenaltiesSaved) = penaltiesSaved_;
     }
 }
@@ -0,0 +1,117 @@
+#include "../include/MappedFile.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FM_HAS_MMAP 1
+#endif
+
+namespace FootballManagement
+{
+    MappedFile::MappedFile() : data_(nullptr), size_(0)
+    {
+    }
+
+    MappedFile::MappedFile(const std::string& fullPath) : data_(nullptr),
+        size_(0)
+    {
+#ifdef FM_HAS_MMAP
+        const int fd = ::open(fullPath.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("Не вдалося відкрити файл для читання.");
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Не вдалося визначити розмір файлу.");
+        }
+
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ > 0)
+        {
+            void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd,
+                                   0);
+            if (mapping == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error(
+                    "Не вдалося відобразити файл у пам'ять.");
+            }
+            ::madvise(mapping, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(mapping);
+        }
+        ::close(fd);
+#else
+        std::ifstream file(fullPath, std::ios::binary);
+        if (!file.is_open())
+            throw std::runtime_error("Не вдалося відкрити файл для читання.");
+
+        std::stringstream ss;
+        ss << file.rdbuf();
+        fallbackBuffer_ = std::move(ss).str();
+        data_ = fallbackBuffer_.data();
+        size_ = fallbackBuffer_.size();
+#endif
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept :
+        data_(other.data_), size_(other.size_),
+        fallbackBuffer_(std::move(other.fallbackBuffer_))
+    {
+        if (!fallbackBuffer_.empty()) data_ = fallbackBuffer_.data();
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            data_ = other.data_;
+            size_ = other.size_;
+            fallbackBuffer_ = std::move(other.fallbackBuffer_);
+            if (!fallbackBuffer_.empty()) data_ = fallbackBuffer_.data();
+
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile() noexcept
+    {
+        Release();
+    }
+
+    void MappedFile::Release() noexcept
+    {
+#ifdef FM_HAS_MMAP
+        if (data_ && fallbackBuffer_.empty())
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+        fallbackBuffer_.clear();
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    std::string_view MappedFile::Data() const
+    {
+        return data_ ? std::string_view(data_, size_) : std::string_view();
+    }
+
+    std::size_t MappedFile::Size() const { return size_; }
+    bool MappedFile::Empty() const { return size_ == 0; }
+
+    LineRange MappedFile::Lines() const
+    {
+        return LineRange(Data());
+    }
+}
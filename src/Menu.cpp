@@ -4,6 +4,8 @@
 #include "../include/FreeAgent.h"
 #include "../include/AuthManager.h"
 #include "../include/FileManager.h"
+#include "../include/RosterJournal.h"
+#include "../include/SlabPool.h"
 
 #include <iostream>
 #include <string>
@@ -13,8 +15,10 @@
 
 namespace FootballManagement
 {
-    Menu::Menu(std::shared_ptr<ClubManager> clubManager) :
-        clubManager_(std::move(clubManager)), isRunning_(true)
+    Menu::Menu(std::shared_ptr<ClubManager> clubManager,
+               std::shared_ptr<AutoSaver> autoSaver) :
+        clubManager_(std::move(clubManager)), autoSaver_(std::move(autoSaver)),
+        isRunning_(true)
     {
     }
 
@@ -22,9 +26,8 @@ namespace FootballManagement
     {
         try
         {
-            const std::vector<std::string> userLines = fileManager_.LoadFromFile(
-                USERS_FILE_NAME);
-            AuthManager::GetInstance().DeserializeAllUsers(userLines);
+            RecordReader userRecords = fileManager_.ReadRecords(USERS_FILE_NAME);
+            AuthManager::GetInstance().DeserializeAllUsers(userRecords);
             std::cout << "[ІНФО] Дані користувачів завантажено." << std::endl;
         }
         catch (const std::exception& e)
@@ -35,13 +38,21 @@ namespace FootballManagement
 
         try
         {
-            std::vector<std::string> playerLines = fileManager_.LoadFromFile(
-                PLAYERS_DATA_FILE);
-            clubManager_->DeserializeAllPlayers(playerLines);
+            if (const auto journal = clubManager_->GetJournal())
+            {
+                journal->Recover(*clubManager_);
+            }
+            else if (!fileManager_.LoadSnapshot(PLAYERS_DATA_FILE, *clubManager_))
+            {
+                playersLoadFailed_ = true;
+                return;
+            }
+            playersLoadFailed_ = false;
             std::cout << "[ІНФО] Дані гравців завантажено." << std::endl;
         }
         catch (const std::exception& e)
         {
+            playersLoadFailed_ = true;
             std::cout << "[ПОМИЛКА] Не вдалося завантажити гравців: " << e.
                 what() << std::endl;
         }
@@ -51,6 +62,31 @@ namespace FootballManagement
     {
         std::cout << "[ІНФО] Збереження даних..." << std::endl;
         fileManager_.SaveToFile(USERS_FILE_NAME, AuthManager::GetInstance());
+
+        if (playersLoadFailed_)
+        {
+            std::cout << "[ПОПЕРЕДЖЕННЯ] Склад не завантажено — файл гравців "
+                "не перезаписується." << std::endl;
+            return;
+        }
+
+        if (autoSaver_)
+        {
+            autoSaver_->SaveNow();
+            const AutoSaveStats stats = autoSaver_->GetStats();
+            std::cout << "[ІНФО] Автозбереження: записів в останньому проході "
+                << stats.lastRecords << ", " << stats.lastSaveSeconds * 1000.0
+                << " мс; незбережених змін: " << autoSaver_->GetDirtyCount()
+                << "." << std::endl;
+        }
+        else if (const auto journal = clubManager_->GetJournal())
+        {
+            if (!journal->Compact(*clubManager_)) return;
+        }
+        else if (!fileManager_.SaveSnapshot(PLAYERS_DATA_FILE, *clubManager_))
+        {
+            return;
+        }
         std::cout << "[УСПІХ] Усі дані збережено." << std::endl;
     }
 
@@ -208,7 +244,7 @@ namespace FootballManagement
             std::string contractUntil = InputValidator::GetNonEmptyString(
                 "Контракт до (YYYY-MM-DD): ");
 
-            auto newPlayer = std::make_shared<YourDerivedPlayer>(
+            auto newPlayer = MakePooled<ContractedPlayer>(
                 name, age, nationality, origin, height, weight, value, position,
                 salary, contractUntil);
             clubManager_->AddPlayer(newPlayer);
@@ -219,7 +255,7 @@ namespace FootballManagement
                 "Очікувана зарплата: ");
             std::string lastClub = InputValidator::GetNonEmptyString(
                 "Останній клуб: ");
-            auto newAgent = std::make_shared<FreeAgent>(
+            auto newAgent = MakePooled<FreeAgent>(
                 name, age, nationality, origin, height, weight, value, position,
                 expectedSalary, lastClub);
             clubManager_->AddPlayer(newAgent);
@@ -253,13 +289,14 @@ namespace FootballManagement
         }
         else if (choice == 2)
         {
-            clubManager_->SortByPerformanceRating();
-            clubManager_->ViewAllPlayers();
+            int limit = InputValidator::GetIntInRange(
+                "Скільки гравців показати (0 — усіх): ", 0, 1000000);
+            clubManager_->ViewRanking(static_cast<std::size_t>(limit));
         }
         else if (choice == 3)
         {
             std::string status = InputValidator::GetNonEmptyString(
-                "Введіть статус (Active, Injured...): ");
+                "Введіть статус (Активний, Травмований...): ");
             auto results = clubManager_->FilterByStatus(status);
             for (const auto& p : results)
             {
@@ -272,31 +309,53 @@ namespace FootballManagement
     void Menu::transferFlow() const
     {
         std::cout << "\n--- ТРАНСФЕРНИЙ РИНОК ---\n";
-        std::string nameQuery = InputValidator::GetNonEmptyString(
-            "Пошук агента за ім’ям: ");
-        auto found = clubManager_->SearchByName(nameQuery);
+        std::cout << "1. Вибрати агента за ID\n";
+        std::cout << "2. Пошук агента за ім’ям\n";
 
-        std::shared_ptr<FreeAgent> agent = nullptr;
-        for (const auto& p : found)
+        int choice = InputValidator::GetIntInRange("Ваш вибір: ", 1, 2);
+
+        // Між запитами до користувача агента тримаємо за ID: об'єкт у
+        // складі може замінитися копією (див. ClubManager).
+        int agentId = 0;
+        if (choice == 1)
         {
-            agent = std::dynamic_pointer_cast<FreeAgent>(p);
-            if (agent && agent->IsAvailableForNegotiation()) break;
+            int id = InputValidator::GetIntInput("Введіть ID агента: ");
+            const auto agent = std::dynamic_pointer_cast<FreeAgent>(
+                clubManager_->FindById(id));
+            if (agent && agent->IsAvailableForNegotiation()) agentId = id;
+        }
+        else
+        {
+            std::string nameQuery = InputValidator::GetNonEmptyString(
+                "Пошук агента за ім’ям: ");
+            auto found = clubManager_->SearchByName(nameQuery);
+
+            for (Player* p : found)
+            {
+                const auto* candidate = dynamic_cast<FreeAgent*>(p);
+                if (candidate && candidate->IsAvailableForNegotiation())
+                {
+                    agentId = p->GetPlayerId();
+                    break;
+                }
+            }
         }
 
-        if (!agent)
+        if (agentId == 0)
         {
             std::cout << "[ПОМИЛКА] Вільного агента не знайдено.\n";
             return;
         }
 
-        std::cout << "[ІНФО] Знайдено агента: " << agent->GetName() <<
-            std::endl;
+        std::cout << "[ІНФО] Знайдено агента: " <<
+            clubManager_->FindById(agentId)->GetName() << std::endl;
         double offer = InputValidator::GetDoubleInput(
             "Запропонована зарплата: ");
         std::string until = InputValidator::GetNonEmptyString(
             "Контракт до (YYYY-MM-DD): ");
 
-        if (clubManager_->SignFreeAgent(agent, offer, until))
+        if (clubManager_->SignFreeAgent(std::dynamic_pointer_cast<FreeAgent>(
+                clubManager_->FindById(agentId)), offer, until))
             std::cout << "[УСПІХ] Контракт підписано.\n";
         else
             std::cout << "[ПОМИЛКА] Не вдалося підписати контракт.\n";
@@ -0,0 +1,332 @@
+#include "../include/NameIndex.h"
+#include "../include/TextFolding.h"
+#include <algorithm>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        using PostingIterator = std::vector<std::uint32_t>::const_iterator;
+
+        /**
+         * @brief Експоненційний пошук першого елемента >= target, починаючи з first.
+         * Дешевший за lower_bound по всьому хвосту, коли ціль близько.
+         */
+        PostingIterator Gallop(PostingIterator first, PostingIterator last,
+                               std::uint32_t target)
+        {
+            std::ptrdiff_t step = 1;
+            PostingIterator low = first;
+            while (last - low > step && *(low + step) < target)
+            {
+                low += step;
+                step *= 2;
+            }
+            return std::lower_bound(low, last - low > step ? low + step + 1 : last,
+                                    target);
+        }
+    }
+
+    NameIndex::NameIndex() : deadCount_(0)
+    {
+    }
+
+    std::string NameIndex::Fold(std::string_view name)
+    {
+        return FoldCase(name);
+    }
+
+    void NameIndex::DecodeCodePoints(std::string_view text,
+                                     std::vector<std::uint32_t>& codePoints)
+    {
+        codePoints.clear();
+        std::size_t i = 0;
+        while (i < text.size())
+        {
+            const auto lead = static_cast<unsigned char>(text[i]);
+            std::size_t length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 :
+                lead < 0xF0 ? 3 : 4;
+            if (lead >= 0x80 && lead < 0xC0) length = 1;
+            if (i + length > text.size()) length = 1;
+
+            std::uint32_t cp = length == 1 ? lead :
+                lead & (0xFFu >> (length + 1));
+            for (std::size_t k = 1; k < length; ++k)
+                cp = cp << 6 | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+
+            codePoints.push_back(cp);
+            i += length;
+        }
+    }
+
+    std::uint64_t NameIndex::GramKey(const std::uint32_t* codePoints,
+                                     std::size_t length)
+    {
+        // Кодова точка займає до 21 біта; біграми позначено старшим бітом.
+        if (length == 2)
+            return 1ull << 63 | static_cast<std::uint64_t>(codePoints[0]) << 21 |
+                codePoints[1];
+        return static_cast<std::uint64_t>(codePoints[0]) << 42 |
+            static_cast<std::uint64_t>(codePoints[1]) << 21 | codePoints[2];
+    }
+
+    void NameIndex::AddPosting(std::uint64_t key, std::uint32_t doc)
+    {
+        // Документи додаються за зростанням номера, тож повтор n-грами
+        // в одному імені видно за останнім елементом списку.
+        std::vector<std::uint32_t>& list = postings_[key];
+        if (list.empty() || list.back() != doc)
+            list.push_back(doc);
+    }
+
+    void NameIndex::IndexDocument(std::uint32_t doc)
+    {
+        std::vector<std::uint32_t> cps;
+        DecodeCodePoints(folded_[doc], cps);
+        for (std::size_t i = 0; i + 2 <= cps.size(); ++i)
+        {
+            AddPosting(GramKey(&cps[i], 2), doc);
+            if (i + 3 <= cps.size())
+                AddPosting(GramKey(&cps[i], 3), doc);
+        }
+    }
+
+    void NameIndex::Insert(int playerId, std::string_view name)
+    {
+        std::string folded = Fold(name);
+
+        const auto it = docById_.find(playerId);
+        if (it != docById_.end())
+        {
+            if (folded_[it->second] == folded) return;
+            Erase(playerId);
+        }
+
+        const auto doc = static_cast<std::uint32_t>(folded_.size());
+        folded_.push_back(std::move(folded));
+        playerIds_.push_back(playerId);
+        alive_.push_back(true);
+        docById_.emplace(playerId, doc);
+        IndexDocument(doc);
+    }
+
+    void NameIndex::Erase(int playerId)
+    {
+        const auto it = docById_.find(playerId);
+        if (it == docById_.end()) return;
+
+        alive_[it->second] = false;
+        folded_[it->second].clear();
+        folded_[it->second].shrink_to_fit();
+        docById_.erase(it);
+        ++deadCount_;
+
+        if (deadCount_ > docById_.size() && deadCount_ > 1024)
+            Compact();
+    }
+
+    void NameIndex::Compact()
+    {
+        std::vector<std::string> folded;
+        std::vector<int> playerIds;
+        folded.reserve(docById_.size());
+        playerIds.reserve(docById_.size());
+
+        for (std::size_t doc = 0; doc < folded_.size(); ++doc)
+        {
+            if (!alive_[doc]) continue;
+            folded.push_back(std::move(folded_[doc]));
+            playerIds.push_back(playerIds_[doc]);
+        }
+
+        folded_ = std::move(folded);
+        playerIds_ = std::move(playerIds);
+        alive_.assign(folded_.size(), true);
+        deadCount_ = 0;
+        docById_.clear();
+        postings_.clear();
+
+        for (std::uint32_t doc = 0; doc < folded_.size(); ++doc)
+        {
+            docById_.emplace(playerIds_[doc], doc);
+            IndexDocument(doc);
+        }
+    }
+
+    bool NameIndex::Contains(int playerId) const
+    {
+        return docById_.contains(playerId);
+    }
+
+    void NameIndex::Append(NameIndex&& other)
+    {
+        const auto base = static_cast<std::uint32_t>(folded_.size());
+        for (std::size_t doc = 0; doc < other.folded_.size(); ++doc)
+        {
+            const bool alive = other.alive_[doc] &&
+                docById_.emplace(other.playerIds_[doc],
+                                 base + static_cast<std::uint32_t>(doc)).second;
+            folded_.push_back(alive ? std::move(other.folded_[doc]) : std::string());
+            playerIds_.push_back(other.playerIds_[doc]);
+            alive_.push_back(alive);
+            if (!alive) ++deadCount_;
+        }
+
+        // Документи іншого індексу йдуть після наших, тож списки лишаються
+        // відсортованими.
+        for (const auto& [key, docs] : other.postings_)
+        {
+            std::vector<std::uint32_t>& list = postings_[key];
+            list.reserve(list.size() + docs.size());
+            for (const std::uint32_t doc : docs) list.push_back(base + doc);
+        }
+        other.Clear();
+
+        if (deadCount_ > docById_.size() && deadCount_ > 1024)
+            Compact();
+    }
+
+    void NameIndex::Clear()
+    {
+        folded_.clear();
+        playerIds_.clear();
+        alive_.clear();
+        docById_.clear();
+        postings_.clear();
+        deadCount_ = 0;
+    }
+
+    void NameIndex::Reserve(std::size_t count)
+    {
+        folded_.reserve(count);
+        playerIds_.reserve(count);
+        alive_.reserve(count);
+        docById_.reserve(count);
+    }
+
+    std::vector<int> NameIndex::Search(std::string_view query,
+                                       std::size_t limit) const
+    {
+        const std::string folded = Fold(query);
+        std::vector<int> results;
+        if (limit == 0) limit = folded_.size();
+
+        std::vector<std::uint32_t> cps;
+        DecodeCodePoints(folded, cps);
+
+        if (cps.size() < 2)
+        {
+            for (std::size_t doc = 0;
+                 doc < folded_.size() && results.size() < limit; ++doc)
+            {
+                if (alive_[doc] &&
+                    folded_[doc].find(folded) != std::string::npos)
+                    results.push_back(playerIds_[doc]);
+            }
+            return results;
+        }
+
+        if (cps.size() == 2)
+        {
+            // Запит із двох символів збігається з біграмою — перевірка не потрібна.
+            const auto it = postings_.find(GramKey(cps.data(), 2));
+            if (it == postings_.end()) return results;
+            for (const std::uint32_t doc : it->second)
+            {
+                if (results.size() == limit) break;
+                if (alive_[doc]) results.push_back(playerIds_[doc]);
+            }
+            return results;
+        }
+
+        // Кандидати — перетин двох списків: найрідшої триграми та найрідшої з
+        // тих, що не перекриваються з нею (сусідні триграми мають спільні
+        // символи й майже не звужують вибірку).
+        const std::size_t gramCount = cps.size() - 2;
+        std::vector<const std::vector<std::uint32_t>*> lists(gramCount);
+        std::size_t rarestPos = 0;
+        for (std::size_t i = 0; i < gramCount; ++i)
+        {
+            const auto it = postings_.find(GramKey(&cps[i], 3));
+            if (it == postings_.end()) return results;
+            lists[i] = &it->second;
+            if (lists[i]->size() < lists[rarestPos]->size()) rarestPos = i;
+        }
+
+        std::size_t secondPos = rarestPos;
+        for (std::size_t i = 0; i < gramCount; ++i)
+        {
+            const std::size_t distance = i > rarestPos ? i - rarestPos :
+                rarestPos - i;
+            const std::size_t bestDistance = secondPos > rarestPos ?
+                secondPos - rarestPos : rarestPos - secondPos;
+            const bool disjoint = distance >= 3;
+            const bool bestDisjoint = bestDistance >= 3;
+
+            if (disjoint && (!bestDisjoint ||
+                    lists[i]->size() < lists[secondPos]->size()))
+                secondPos = i;
+            else if (!disjoint && !bestDisjoint && distance > bestDistance)
+                secondPos = i;
+        }
+
+        const std::vector<std::uint32_t>& rarest = *lists[rarestPos];
+        const std::vector<std::uint32_t>& second = *lists[secondPos];
+
+        // Кандидати з перетину ще фільтруються рештою списків (курсори лише
+        // рухаються вперед), щоб до рядків імен — повільних промахів кешу —
+        // доходили тільки документи, що містять усі триграми запиту.
+        std::vector<const std::vector<std::uint32_t>*> filters;
+        for (std::size_t i = 0; i < gramCount; ++i)
+        {
+            if (i != rarestPos && i != secondPos) filters.push_back(lists[i]);
+        }
+        std::sort(filters.begin(), filters.end());
+        filters.erase(std::unique(filters.begin(), filters.end()), filters.end());
+        std::sort(filters.begin(), filters.end(),
+                  [](const auto* x, const auto* y) { return x->size() < y->size(); });
+        std::vector<PostingIterator> filterCursors;
+        filterCursors.reserve(filters.size());
+        for (const auto* list : filters) filterCursors.push_back(list->begin());
+
+        // Довший список перестрибується експоненційним пошуком лише тоді, коли
+        // він суттєво довший; інакше послідовне злиття швидше.
+        const bool gallop = second.size() > 16 * rarest.size();
+        PostingIterator a = rarest.begin();
+        PostingIterator b = second.begin();
+
+        while (a != rarest.end() && b != second.end() && results.size() < limit)
+        {
+            if (*a < *b)
+            {
+                ++a;
+                continue;
+            }
+            if (*b < *a)
+            {
+                b = gallop ? Gallop(b, second.end(), *a) : b + 1;
+                continue;
+            }
+
+            const std::uint32_t doc = *a;
+            ++a;
+            ++b;
+
+            bool candidate = true;
+            for (std::size_t i = 0; i < filters.size() && candidate; ++i)
+            {
+                filterCursors[i] = Gallop(filterCursors[i], filters[i]->end(),
+                                          doc);
+                if (filterCursors[i] == filters[i]->end()) return results;
+                candidate = *filterCursors[i] == doc;
+            }
+
+            if (candidate && alive_[doc] &&
+                folded_[doc].find(folded) != std::string::npos)
+                results.push_back(playerIds_[doc]);
+        }
+        return results;
+    }
+
+    std::size_t NameIndex::Size() const { return docById_.size(); }
+}
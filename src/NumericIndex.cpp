@@ -0,0 +1,296 @@
+#include "../include/NumericIndex.h"
+#include <algorithm>
+#include <limits>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        constexpr int MIN_ID = std::numeric_limits<int>::min();
+        constexpr int MAX_ID = std::numeric_limits<int>::max();
+
+        bool Less(const NumericIndex::Entry& a, const NumericIndex::Entry& b)
+        {
+            if (a.key != b.key) return a.key < b.key;
+            return a.playerId < b.playerId;
+        }
+    }
+
+    NumericIndex::Cursor NumericIndex::LowerBound(const Entry& entry) const
+    {
+        // Блоки впорядковані, тож шукається перший блок, чий останній
+        // елемент не менший за entry; далі — двійковий пошук у ньому.
+        const auto block = std::partition_point(
+            blocks_.begin(), blocks_.end(),
+            [&entry](const std::vector<Entry>& b) { return Less(b.back(), entry); });
+        if (block == blocks_.end()) return {blocks_.size(), 0};
+
+        const auto offset = std::lower_bound(block->begin(), block->end(), entry,
+                                             Less);
+        return {static_cast<std::size_t>(block - blocks_.begin()),
+                static_cast<std::size_t>(offset - block->begin())};
+    }
+
+    NumericIndex::Cursor NumericIndex::UpperBound(const Entry& entry) const
+    {
+        const auto block = std::partition_point(
+            blocks_.begin(), blocks_.end(),
+            [&entry](const std::vector<Entry>& b) { return !Less(entry, b.back()); });
+        if (block == blocks_.end()) return {blocks_.size(), 0};
+
+        const auto offset = std::upper_bound(block->begin(), block->end(), entry,
+                                             Less);
+        return {static_cast<std::size_t>(block - blocks_.begin()),
+                static_cast<std::size_t>(offset - block->begin())};
+    }
+
+    void NumericIndex::Insert(const Entry& entry)
+    {
+        ++size_;
+        if (blocks_.empty())
+        {
+            blocks_.push_back({entry});
+            return;
+        }
+
+        Cursor position = LowerBound(entry);
+        if (position.block == blocks_.size())
+        {
+            // Більший за всі елементи — дописується в останній блок.
+            position = {blocks_.size() - 1, blocks_.back().size()};
+        }
+
+        std::vector<Entry>& block = blocks_[position.block];
+        block.insert(block.begin() + static_cast<std::ptrdiff_t>(position.offset),
+                     entry);
+
+        if (block.size() > MAX_BLOCK_SIZE)
+        {
+            const auto middle = block.begin() +
+                static_cast<std::ptrdiff_t>(block.size() / 2);
+            std::vector<Entry> upper(middle, block.end());
+            block.erase(middle, block.end());
+            blocks_.insert(blocks_.begin() +
+                           static_cast<std::ptrdiff_t>(position.block + 1),
+                           std::move(upper));
+        }
+    }
+
+    void NumericIndex::Remove(const Entry& entry)
+    {
+        const Cursor position = LowerBound(entry);
+        if (position.block == blocks_.size()) return;
+
+        std::vector<Entry>& block = blocks_[position.block];
+        const Entry& found = block[position.offset];
+        if (found.key != entry.key || found.playerId != entry.playerId) return;
+
+        block.erase(block.begin() + static_cast<std::ptrdiff_t>(position.offset));
+        --size_;
+        if (block.empty())
+            blocks_.erase(blocks_.begin() +
+                          static_cast<std::ptrdiff_t>(position.block));
+    }
+
+    void NumericIndex::Upsert(int playerId, double key)
+    {
+        const auto [it, inserted] = keyById_.try_emplace(playerId, key);
+        if (!inserted)
+        {
+            if (it->second == key) return;
+            Remove({it->second, playerId});
+            it->second = key;
+        }
+        Insert({key, playerId});
+    }
+
+    void NumericIndex::UpsertBatch(std::span<const Entry> entries)
+    {
+        std::vector<Entry> removed;
+        std::vector<Entry> added;
+        for (const Entry& entry : entries)
+        {
+            const auto [it, inserted] = keyById_.try_emplace(entry.playerId,
+                                                             entry.key);
+            if (!inserted)
+            {
+                if (it->second == entry.key) continue;
+                removed.push_back({it->second, entry.playerId});
+                it->second = entry.key;
+            }
+            added.push_back(entry);
+        }
+        if (added.empty()) return;
+
+        // Повторюваний ID міг потрапити в added кілька разів; лишається
+        // лише пара з актуальним значенням.
+        std::erase_if(added, [this](const Entry& entry)
+        {
+            return keyById_.at(entry.playerId) != entry.key;
+        });
+
+        // Кілька змін дешевше вставити точково, ніж перебудовувати блоки.
+        if (added.size() * 16 < size_)
+        {
+            for (const Entry& entry : removed) Remove(entry);
+            for (const Entry& entry : added) Insert(entry);
+            return;
+        }
+
+        std::sort(removed.begin(), removed.end(), Less);
+        std::sort(added.begin(), added.end(), Less);
+        added.erase(std::unique(added.begin(), added.end(),
+                                [](const Entry& a, const Entry& b)
+                                {
+                                    return a.key == b.key && a.playerId == b.playerId;
+                                }),
+                    added.end());
+
+        // Злиття старих листків (без застарілих пар) з новими парами.
+        std::vector<Entry> merged;
+        merged.reserve(size_ + added.size());
+        auto stale = removed.begin();
+        auto fresh = added.begin();
+        for (const std::vector<Entry>& block : blocks_)
+        {
+            for (const Entry& entry : block)
+            {
+                while (stale != removed.end() && Less(*stale, entry)) ++stale;
+                if (stale != removed.end() && !Less(entry, *stale))
+                {
+                    ++stale;
+                    continue;
+                }
+                while (fresh != added.end() && Less(*fresh, entry))
+                    merged.push_back(*fresh++);
+                merged.push_back(entry);
+            }
+        }
+        merged.insert(merged.end(), fresh, added.end());
+
+        // Блоки заповнюються наполовину, щоб наступні вставки не ділили їх одразу.
+        constexpr std::size_t FILL = MAX_BLOCK_SIZE / 2;
+        blocks_.clear();
+        blocks_.reserve(merged.size() / FILL + 1);
+        for (std::size_t begin = 0; begin < merged.size(); begin += FILL)
+        {
+            const std::size_t end = std::min(begin + FILL, merged.size());
+            blocks_.emplace_back(merged.begin() + static_cast<std::ptrdiff_t>(begin),
+                                 merged.begin() + static_cast<std::ptrdiff_t>(end));
+        }
+        size_ = merged.size();
+    }
+
+    void NumericIndex::Erase(int playerId)
+    {
+        const auto it = keyById_.find(playerId);
+        if (it == keyById_.end()) return;
+
+        Remove({it->second, playerId});
+        keyById_.erase(it);
+    }
+
+    void NumericIndex::Clear()
+    {
+        blocks_.clear();
+        keyById_.clear();
+        size_ = 0;
+    }
+
+    void NumericIndex::Reserve(std::size_t count)
+    {
+        keyById_.reserve(count);
+        blocks_.reserve(count / (MAX_BLOCK_SIZE / 2) + 1);
+    }
+
+    std::size_t NumericIndex::Size() const { return size_; }
+
+    std::optional<double> NumericIndex::KeyOf(int playerId) const
+    {
+        const auto it = keyById_.find(playerId);
+        if (it == keyById_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    void NumericIndex::ForEachInRange(double minKey, double maxKey,
+                                      bool descending,
+                                      const std::function<bool(int)>& visit) const
+    {
+        if (minKey > maxKey) return;
+
+        const Cursor first = LowerBound({minKey, MIN_ID});
+        const Cursor last = UpperBound({maxKey, MAX_ID});
+
+        if (!descending)
+        {
+            for (std::size_t b = first.block; b < blocks_.size(); ++b)
+            {
+                const std::size_t begin = b == first.block ? first.offset : 0;
+                const std::size_t end = b == last.block ? last.offset
+                                                        : blocks_[b].size();
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    if (!visit(blocks_[b][i].playerId)) return;
+                }
+                if (b == last.block) return;
+            }
+            return;
+        }
+
+        // Від більших значень до менших; група рівних значень збирається
+        // (її ID ідуть за спаданням) і віддається у зворотному порядку, щоб
+        // ID ішли за зростанням — так само, як при сортуванні.
+        std::vector<int> run;
+        double runKey = 0.0;
+        const auto flush = [&run, &visit]
+        {
+            for (auto it = run.rbegin(); it != run.rend(); ++it)
+            {
+                if (!visit(*it)) return false;
+            }
+            run.clear();
+            return true;
+        };
+
+        for (std::size_t b = std::min(last.block + 1, blocks_.size());
+             b-- > first.block;)
+        {
+            const std::size_t begin = b == first.block ? first.offset : 0;
+            const std::size_t end = b == last.block ? last.offset
+                                                    : blocks_[b].size();
+            for (std::size_t i = end; i-- > begin;)
+            {
+                const Entry& entry = blocks_[b][i];
+                if (!run.empty() && entry.key != runKey && !flush()) return;
+                runKey = entry.key;
+                run.push_back(entry.playerId);
+            }
+        }
+        flush();
+    }
+
+    std::size_t NumericIndex::CountInRange(double minKey, double maxKey) const
+    {
+        if (minKey > maxKey) return 0;
+
+        const Cursor first = LowerBound({minKey, MIN_ID});
+        const Cursor last = UpperBound({maxKey, MAX_ID});
+        if (first.block == last.block) return last.offset - first.offset;
+
+        std::size_t count = blocks_[first.block].size() - first.offset;
+        for (std::size_t b = first.block + 1; b < last.block; ++b)
+            count += blocks_[b].size();
+        return count + last.offset;
+    }
+
+    std::vector<int> NumericIndex::Range(double minKey, double maxKey) const
+    {
+        std::vector<int> ids;
+        ForEachInRange(minKey, maxKey, false, [&ids](int playerId)
+        {
+            ids.push_back(playerId);
+            return true;
+        });
+        return ids;
+    }
+}
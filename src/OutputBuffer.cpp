@@ -0,0 +1,91 @@
+#include "../include/OutputBuffer.h"
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        // Найдовші представлення, які може видати std::to_chars.
+        constexpr std::size_t MAX_INT_CHARS = 20;
+        constexpr std::size_t MAX_DOUBLE_CHARS = 32;
+    }
+
+    OutputBuffer::OutputBuffer(std::size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    char* OutputBuffer::Grow(std::size_t extra)
+    {
+        if (data_.size() - size_ < extra)
+        {
+            // Подвоєння місткості дає амортизовано O(1) на запис.
+            std::size_t capacity = data_.size() < 64 ? 64 : data_.size();
+            while (capacity - size_ < extra) capacity *= 2;
+            data_.resize(capacity);
+        }
+        return data_.data() + size_;
+    }
+
+    void OutputBuffer::Reserve(std::size_t capacity)
+    {
+        if (capacity > data_.size()) data_.resize(capacity);
+    }
+
+    std::string OutputBuffer::Take()
+    {
+        data_.resize(size_);
+        size_ = 0;
+        return std::exchange(data_, std::string());
+    }
+
+    OutputBuffer& OutputBuffer::Append(std::string_view text)
+    {
+        if (!text.empty())
+        {
+            std::memcpy(Grow(text.size()), text.data(), text.size());
+            size_ += text.size();
+        }
+        return *this;
+    }
+
+    OutputBuffer& OutputBuffer::Append(char c)
+    {
+        *Grow(1) = c;
+        ++size_;
+        return *this;
+    }
+
+    OutputBuffer& OutputBuffer::AppendInt(long long value)
+    {
+        char* begin = Grow(MAX_INT_CHARS);
+        const auto result = std::to_chars(begin, begin + MAX_INT_CHARS, value);
+        size_ += static_cast<std::size_t>(result.ptr - begin);
+        return *this;
+    }
+
+    OutputBuffer& OutputBuffer::AppendDouble(double value)
+    {
+        char* begin = Grow(MAX_DOUBLE_CHARS);
+        const auto result = std::to_chars(begin, begin + MAX_DOUBLE_CHARS, value);
+        size_ += static_cast<std::size_t>(result.ptr - begin);
+        return *this;
+    }
+
+    OutputBuffer& OutputBuffer::AppendBool(bool value)
+    {
+        return Append(value ? std::string_view("true") : std::string_view("false"));
+    }
+
+    OutputBuffer& OutputBuffer::AppendQuoted(std::string_view text)
+    {
+        return Append('"').Append(text).Append('"');
+    }
+
+    OutputBuffer& OutputBuffer::AppendKey(std::string_view key)
+    {
+        return AppendQuoted(key).Append(':');
+    }
+}
@@ -1,6 +1,8 @@
 #include "../include/Player.h"
+#include "../include/BinaryIO.h"
+#include "../include/RecordParser.h"
+#include "../include/RosterColumns.h"
 #include<iostream>
-#include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
@@ -119,6 +121,11 @@ namespace FootballManagement
     double Player::GetMarketValue() const { return marketValue_; }
     bool Player::IsInjured() const { return injured_; }
 
+    PlayerStatus Player::GetStatusFlags() const
+    {
+        return injured_ ? PlayerStatus::Injured : PlayerStatus::None;
+    }
+
     const std::vector<Injury>& Player::GetInjuryHistory() const
     {
         return injuryHistory_;
@@ -141,6 +148,13 @@ namespace FootballManagement
     }
 
 
+    void Player::SetAge(int age)
+    {
+        if (age <= 0)
+            throw std::invalid_argument("Вік повинен бути додатним.");
+        age_ = age;
+    }
+
     void Player::SetNationality(const std::string& nationality)
     {
         if (nationality.empty())
@@ -227,39 +241,106 @@ namespace FootballManagement
 
     std::string Player::Serialize() const
     {
-        std::stringstream ss;
-        ss << "\"id\":" << playerId_ << ","
-            << "\"name\":\"" << name_ << "\","
-            << "\"age\":" << age_ << ","
-            << "\"nationality\":\"" << nationality_ << "\","
-            << "\"origin\":\"" << origin_ << "\","
-            << "\"height\":" << height_ << ","
-            << "\"weight\":" << weight_ << ","
-            << "\"value\":" << marketValue_ << ","
-            << "\"injured\":" << (injured_ ? "true" : "false");
-        return ss.str();
+        OutputBuffer out;
+        AppendTo(out);
+        return out.Take();
+    }
+
+    void Player::AppendTo(OutputBuffer& out) const
+    {
+        out.AppendKey("id").AppendInt(playerId_).Append(',')
+           .AppendKey("name").AppendQuoted(name_).Append(',')
+           .AppendKey("age").AppendInt(age_).Append(',')
+           .AppendKey("nationality").AppendQuoted(nationality_).Append(',')
+           .AppendKey("origin").AppendQuoted(origin_).Append(',')
+           .AppendKey("height").AppendDouble(height_).Append(',')
+           .AppendKey("weight").AppendDouble(weight_).Append(',')
+           .AppendKey("value").AppendDouble(marketValue_).Append(',')
+           .AppendKey("injured").AppendBool(injured_);
     }
 
-    void Player::DeserializeBase(const std::string& json)
+    void Player::DeserializeRecord(std::string_view record)
     {
-        std::regex r("\"(.*?)\":\"?(.*?)\"?(,|})");
-        auto begin = std::sregex_iterator(json.begin(), json.end(), r);
-        auto end = std::sregex_iterator();
+        DeserializeBase(record);
+    }
+
+    void Player::DeserializeBase(std::string_view json)
+    {
+        RecordParser parser(json);
+        RecordField field;
+
+        while (parser.Next(field))
+            DeserializeField(HashKey(field.key), field.value);
+    }
 
-        for (auto it = begin; it != end; ++it)
+    void Player::RequireExactType(const std::type_info& cloneType) const
+    {
+        if (typeid(*this) != cloneType)
+            throw std::logic_error(std::string("Клас ") + typeid(*this).name() +
+                " має перевизначити Clone(), інакше копія буде зрізаною.");
+    }
+
+    bool Player::DeserializeField(std::uint64_t keyHash,
+                                  std::string_view value)
+    {
+        switch (keyHash)
         {
-            std::string key = (*it)[1];
-            std::string value = (*it)[2];
-
-            if (key == "name") name_ = value;
-            else if (key == "nationality") nationality_ = value;
-            else if (key == "origin") origin_ = value;
-            else if (key == "age") age_ = std::stoi(value);
-            else if (key == "height") height_ = std::stod(value);
-            else if (key == "weight") weight_ = std::stod(value);
-            else if (key == "value") marketValue_ = std::stod(value);
-            else if (key == "id") playerId_ = std::stoi(value);
-            else if (key == "injured") injured_ = (value == "true");
+        case HashKey("id"): playerId_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("name"): name_.assign(value);
+            return true;
+        case HashKey("age"): age_ = RecordParser::ParseInt(value);
+            return true;
+        case HashKey("nationality"): nationality_.assign(value);
+            return true;
+        case HashKey("origin"): origin_.assign(value);
+            return true;
+        case HashKey("height"): height_ = RecordParser::ParseDouble(value);
+            return true;
+        case HashKey("weight"): weight_ = RecordParser::ParseDouble(value);
+            return true;
+        case HashKey("value"): marketValue_ = RecordParser::ParseDouble(value);
+            return true;
+        case HashKey("injured"): injured_ = RecordParser::ParseBool(value);
+            return true;
+        default: return false;
         }
     }
+
+    void Player::WriteBinary(BinaryWriter& writer) const
+    {
+        writer.WriteI32(playerId_);
+        writer.WriteString(name_);
+        writer.WriteI32(age_);
+        writer.WriteString(nationality_);
+        writer.WriteString(origin_);
+        writer.WriteF64(height_);
+        writer.WriteF64(weight_);
+        writer.WriteF64(marketValue_);
+        writer.WriteBool(injured_);
+    }
+
+    void Player::ReadBinary(BinaryReader& reader)
+    {
+        playerId_ = reader.ReadI32();
+        name_.assign(reader.ReadString());
+        age_ = reader.ReadI32();
+        nationality_.assign(reader.ReadString());
+        origin_.assign(reader.ReadString());
+        height_ = reader.ReadF64();
+        weight_ = reader.ReadF64();
+        marketValue_ = reader.ReadF64();
+        injured_ = reader.ReadBool();
+    }
+
+    void Player::WriteColumns(RosterRow& row) const
+    {
+        row.playerId = playerId_;
+        row.position = GetPosition();
+        row.Int(RosterColumn::Age) = age_;
+        row.Double(RosterColumn::Height) = height_;
+        row.Double(RosterColumn::Weight) = weight_;
+        row.Double(RosterColumn::MarketValue) = marketValue_;
+        row.Double(RosterColumn::Rating) = CalculatePerformanceRating();
+    }
 }
@@ -0,0 +1,131 @@
+#include "../include/PlayerBatches.h"
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        template <typename T>
+        constexpr bool IS_OPEN_TYPE = std::is_same_v<T, Player>;
+
+        void CheckOutputSize(std::span<double> out, std::size_t size)
+        {
+            if (out.size() != size)
+                throw std::invalid_argument(
+                    "Розмір масиву результатів не збігається з розміром складу.");
+        }
+    }
+
+    PlayerVariant ClassifyPlayer(const Player& player)
+    {
+        // Порівнюється точний тип: похідні від вбудованих класів можуть
+        // перевизначати формули, тож їм потрібен віртуальний шлях.
+        const std::type_info& type = typeid(player);
+        if (type == typeid(Goalkeeper))
+            return static_cast<const Goalkeeper*>(&player);
+        if (type == typeid(FreeAgent))
+            return static_cast<const FreeAgent*>(&player);
+        if (type == typeid(ContractedPlayer))
+            return static_cast<const ContractedPlayer*>(&player);
+        return &player;
+    }
+
+    PlayerBatches::PlayerBatches(
+        const std::vector<std::shared_ptr<Player>>& players)
+    {
+        for (const auto& player : players)
+        {
+            std::visit([this](auto typed)
+            {
+                using T = std::remove_const_t<std::remove_pointer_t<decltype(typed)>>;
+                if constexpr (std::is_same_v<T, Goalkeeper>)
+                    goalkeepers_.push_back(typed);
+                else if constexpr (std::is_same_v<T, FreeAgent>)
+                    freeAgents_.push_back(typed);
+                else if constexpr (std::is_same_v<T, ContractedPlayer>)
+                    contracted_.push_back(typed);
+                else
+                    others_.push_back(typed);
+            }, ClassifyPlayer(*player));
+        }
+
+        playerIds_.reserve(players.size());
+        ForEachBatch([this](auto batch, std::size_t)
+        {
+            for (const auto* player : batch)
+                playerIds_.push_back(player->GetPlayerId());
+        });
+    }
+
+    std::size_t PlayerBatches::Size() const { return playerIds_.size(); }
+
+    std::span<const int> PlayerBatches::PlayerIds() const { return playerIds_; }
+
+    void PlayerBatches::Ratings(std::span<double> out) const
+    {
+        CheckOutputSize(out, Size());
+        ForEachBatch([out](auto batch, std::size_t offset)
+        {
+            using T = std::remove_const_t<std::remove_pointer_t<
+                typename decltype(batch)::value_type>>;
+            const std::span<double> target = out.subspan(offset, batch.size());
+            if constexpr (IS_OPEN_TYPE<T>)
+            {
+                for (std::size_t i = 0; i < batch.size(); ++i)
+                    target[i] = batch[i]->CalculatePerformanceRating();
+            }
+            else
+                T::RateBatch(batch, target);
+        });
+    }
+
+    void PlayerBatches::Values(std::span<double> out) const
+    {
+        CheckOutputSize(out, Size());
+        ForEachBatch([out](auto batch, std::size_t offset)
+        {
+            using T = std::remove_const_t<std::remove_pointer_t<
+                typename decltype(batch)::value_type>>;
+            const std::span<double> target = out.subspan(offset, batch.size());
+            if constexpr (IS_OPEN_TYPE<T>)
+            {
+                for (std::size_t i = 0; i < batch.size(); ++i)
+                    target[i] = batch[i]->CalculateValue();
+            }
+            else
+                T::ValueBatch(batch, target);
+        });
+    }
+
+    double PlayerBatches::TotalValue() const
+    {
+        std::vector<double> values(Size());
+        Values(values);
+        double total = 0.0;
+        for (const double value : values) total += value;
+        return total;
+    }
+
+    std::vector<int> PlayerBatches::Filter(const StatusFilter& filter) const
+    {
+        std::vector<int> ids;
+        ForEachBatch([this, &filter, &ids](auto batch, std::size_t offset)
+        {
+            using T = std::remove_const_t<std::remove_pointer_t<
+                typename decltype(batch)::value_type>>;
+            for (std::size_t i = 0; i < batch.size(); ++i)
+            {
+                // Кваліфікований виклик обходить таблицю віртуальних функцій.
+                PlayerStatus flags;
+                if constexpr (IS_OPEN_TYPE<T>)
+                    flags = batch[i]->GetStatusFlags();
+                else
+                    flags = batch[i]->T::GetStatusFlags();
+                if (filter.Matches(flags)) ids.push_back(playerIds_[offset + i]);
+            }
+        });
+        return ids;
+    }
+}
@@ -0,0 +1,95 @@
+#include "../include/PlayerFactory.h"
+#include "../include/RecordParser.h"
+#include "../include/Goalkeepeer.h"
+#include "../include/FreeAgent.h"
+#include "../include/ContractedPlayer.h"
+#include <stdexcept>
+
+namespace FootballManagement
+{
+    PlayerFactory::PlayerFactory()
+    {
+        Register(GOALKEEPER_TYPE_TAG, PlayerRecordTag::Goalkeeper,
+                 []() -> std::shared_ptr<Player>
+        {
+            return MakePooled<Goalkeeper>();
+        }, &SlabAllocator<Goalkeeper>::Arena);
+        Register(FREE_AGENT_TYPE_TAG, PlayerRecordTag::FreeAgent,
+                 []() -> std::shared_ptr<Player>
+        {
+            return MakePooled<FreeAgent>();
+        }, &SlabAllocator<FreeAgent>::Arena);
+        Register(CONTRACTED_PLAYER_TYPE_TAG, PlayerRecordTag::ContractedPlayer,
+                 []() -> std::shared_ptr<Player>
+        {
+            return MakePooled<ContractedPlayer>();
+        }, &SlabAllocator<ContractedPlayer>::Arena);
+    }
+
+    PlayerFactory& PlayerFactory::GetInstance()
+    {
+        static PlayerFactory instance;
+        return instance;
+    }
+
+    void PlayerFactory::Register(std::string_view typeTag,
+                                 PlayerRecordTag recordTag, Creator creator,
+                                 ArenaAccessor arena)
+    {
+        if (typeTag.empty() || !creator)
+            throw std::invalid_argument(
+                "Тег типу та функція створення не можуть бути порожніми.");
+        creators_[HashKey(typeTag)] = creator;
+        binaryCreators_[static_cast<std::uint8_t>(recordTag)] = creator;
+        if (arena) pooledTypes_.push_back({creator, arena});
+    }
+
+    void PlayerFactory::ReservePooled(std::size_t count) const
+    {
+        if (count == 0 || pooledTypes_.empty()) return;
+
+        std::size_t liveTotal = 0;
+        for (const PooledType& type : pooledTypes_)
+            liveTotal += type.arena().Stats().liveNodes;
+
+        for (const PooledType& type : pooledTypes_)
+        {
+            SlabArena& arena = type.arena();
+            // Розмір вузла фіксує перше виділення, тож порожня арена
+            // отримує його від тимчасового об'єкта.
+            if (arena.Stats().nodeSize == 0) (void)type.creator();
+
+            const std::size_t live = arena.Stats().liveNodes;
+            const std::size_t share = liveTotal == 0
+                ? count / pooledTypes_.size() + 1
+                : static_cast<std::size_t>(static_cast<double>(count) *
+                    static_cast<double>(live) / static_cast<double>(liveTotal)) + 1;
+            arena.Reserve(share);
+        }
+    }
+
+    std::shared_ptr<Player> PlayerFactory::Create(std::string_view record) const
+    {
+        RecordParser parser(record);
+        RecordField field;
+
+        if (!parser.Next(field) || HashKey(field.key) != HashKey(PLAYER_TYPE_KEY))
+            throw std::invalid_argument("Запис не містить тегу типу гравця.");
+
+        const auto it = creators_.find(HashKey(field.value));
+        if (it == creators_.end())
+            throw std::invalid_argument("Невідомий тип гравця у записі.");
+
+        std::shared_ptr<Player> player = it->second();
+        player->DeserializeRecord(record);
+        return player;
+    }
+
+    std::shared_ptr<Player> PlayerFactory::Create(
+        PlayerRecordTag recordTag) const
+    {
+        const auto it = binaryCreators_.find(
+            static_cast<std::uint8_t>(recordTag));
+        return it == binaryCreators_.end() ? nullptr : it->second();
+    }
+}
@@ -0,0 +1,52 @@
+#include "../include/PlayerStatus.h"
+#include "../include/TextFolding.h"
+#include <array>
+#include <string>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        struct StatusLabel
+        {
+            StatusFilter filter;
+            std::string_view text;
+        };
+
+        using enum PlayerStatus;
+
+        // Умови взаємовиключні: тип гравця (воротар / вільний агент /
+        // контрактний) задається рівно одним прапорцем.
+        constexpr std::array<StatusLabel, 8> STATUS_LABELS = {{
+            {{Goalkeeper | Injured, None}, "Травмований воротар"},
+            {{Goalkeeper, Injured}, "Активний воротар"},
+            {{FreeAgent | Injured, None}, "Травмований вільний агент"},
+            {{FreeAgent | ContractSigned, Injured}, "Контракт підписано"},
+            {{FreeAgent, Injured | ContractSigned}, "Вільний агент (активний)"},
+            {{Contracted | Injured, None}, "Травмований гравець"},
+            {{Contracted | OnLoan, Injured}, "В оренді"},
+            {{Contracted, Injured | OnLoan}, "Активний гравець"},
+        }};
+    }
+
+    std::string_view DescribeStatus(PlayerStatus flags)
+    {
+        for (const StatusLabel& label : STATUS_LABELS)
+        {
+            if (label.filter.Matches(flags)) return label.text;
+        }
+        return "Невідомий статус";
+    }
+
+    std::vector<StatusFilter> ParseStatusQuery(std::string_view query)
+    {
+        const std::string folded = FoldCase(query);
+        std::vector<StatusFilter> filters;
+        for (const StatusLabel& label : STATUS_LABELS)
+        {
+            if (FoldCase(label.text).find(folded) != std::string::npos)
+                filters.push_back(label.filter);
+        }
+        return filters;
+    }
+}
@@ -0,0 +1,72 @@
+#include "../include/RankingView.h"
+#include "../include/PlayerBatches.h"
+#include <algorithm>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        bool RanksHigher(const RankingEntry& a, const RankingEntry& b)
+        {
+            if (a.rating != b.rating) return a.rating > b.rating;
+            return a.playerId < b.playerId;
+        }
+    }
+
+    RankingView::RankingView(
+        const std::vector<std::shared_ptr<Player>>& players) : sortedPrefix_(0)
+    {
+        // Рейтинги рахуються пакетами за конкретним типом, без віртуального
+        // виклику на кожного гравця.
+        const PlayerBatches batches(players);
+        std::vector<double> ratings(batches.Size());
+        batches.Ratings(ratings);
+
+        const std::span<const int> ids = batches.PlayerIds();
+        entries_.reserve(ratings.size());
+        for (std::size_t i = 0; i < ratings.size(); ++i)
+            entries_.push_back({ratings[i], ids[i]});
+    }
+
+    RankingView::RankingView(std::span<const double> ratings,
+                             std::span<const int> playerIds) : sortedPrefix_(0)
+    {
+        entries_.reserve(ratings.size());
+        for (std::size_t i = 0; i < ratings.size(); ++i)
+            entries_.push_back({ratings[i], playerIds[i]});
+    }
+
+    std::vector<RankingEntry> RankingView::TopK(std::size_t k)
+    {
+        const std::span<const RankingEntry> prefix = Prefix(k);
+        return {prefix.begin(), prefix.end()};
+    }
+
+    std::span<const RankingEntry> RankingView::Prefix(std::size_t k)
+    {
+        k = std::min(k, entries_.size());
+        if (k > sortedPrefix_)
+        {
+            // Усі позиції перед sortedPrefix_ уже стоять на своїх місцях,
+            // тому досортовується лише хвіст.
+            std::partial_sort(entries_.begin() + sortedPrefix_,
+                              entries_.begin() + k, entries_.end(),
+                              RanksHigher);
+            sortedPrefix_ = k;
+        }
+        return {entries_.data(), k};
+    }
+
+    const std::vector<RankingEntry>& RankingView::Ranked()
+    {
+        if (sortedPrefix_ < entries_.size())
+        {
+            std::sort(entries_.begin() + sortedPrefix_, entries_.end(),
+                      RanksHigher);
+            sortedPrefix_ = entries_.size();
+        }
+        return entries_;
+    }
+
+    std::size_t RankingView::Size() const { return entries_.size(); }
+}
@@ -0,0 +1,200 @@
+#include "../include/RatingKernels.h"
+#include "RatingKernelsImpl.h"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COURSEWORK_SSE2_KERNELS 1
+#endif
+
+namespace FootballManagement
+{
+    namespace
+    {
+        using RatingKernelsImpl::KernelTable;
+        using RatingKernelsImpl::Kernels;
+
+        /**
+         * @brief Скалярні операції: по одному значенню, як у методах класів.
+         */
+        struct ScalarOps
+        {
+            using V = double;
+            using M = bool;
+            static constexpr std::size_t WIDTH = 1;
+
+            static V LoadInt(const std::int32_t* p) { return static_cast<double>(*p); }
+            static V Load(const double* p) { return *p; }
+            static void Store(double* p, V v) { *p = v; }
+            static V Set(double value) { return value; }
+            static V Add(V a, V b) { return a + b; }
+            static V Sub(V a, V b) { return a - b; }
+            static V Mul(V a, V b) { return a * b; }
+            static V Div(V a, V b) { return a / b; }
+            static M Eq(V a, V b) { return a == b; }
+            static M Lt(V a, V b) { return a < b; }
+            static V Select(M mask, V ifTrue, V ifFalse) { return mask ? ifTrue : ifFalse; }
+        };
+
+#if defined(COURSEWORK_SSE2_KERNELS)
+        /**
+         * @brief Операції SSE2: два значення double за інструкцію.
+         */
+        struct Sse2Ops
+        {
+            using V = __m128d;
+            using M = __m128d;
+            static constexpr std::size_t WIDTH = 2;
+
+            static V LoadInt(const std::int32_t* p)
+            {
+                return _mm_cvtepi32_pd(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+            }
+
+            static V Load(const double* p) { return _mm_loadu_pd(p); }
+            static void Store(double* p, V v) { _mm_storeu_pd(p, v); }
+            static V Set(double value) { return _mm_set1_pd(value); }
+            static V Add(V a, V b) { return _mm_add_pd(a, b); }
+            static V Sub(V a, V b) { return _mm_sub_pd(a, b); }
+            static V Mul(V a, V b) { return _mm_mul_pd(a, b); }
+            static V Div(V a, V b) { return _mm_div_pd(a, b); }
+            static M Eq(V a, V b) { return _mm_cmpeq_pd(a, b); }
+            static M Lt(V a, V b) { return _mm_cmplt_pd(a, b); }
+
+            static V Select(M mask, V ifTrue, V ifFalse)
+            {
+                return _mm_or_pd(_mm_and_pd(mask, ifTrue),
+                                 _mm_andnot_pd(mask, ifFalse));
+            }
+        };
+#endif
+
+        std::atomic<SimdLevel>& ActiveLevel()
+        {
+            static std::atomic<SimdLevel> level{DetectSimdLevel()};
+            return level;
+        }
+
+        const KernelTable& Table()
+        {
+            switch (ActiveSimdLevel())
+            {
+#if defined(COURSEWORK_AVX2_KERNELS)
+            case SimdLevel::Avx2:
+                return RatingKernelsImpl::Avx2Kernels();
+#endif
+#if defined(COURSEWORK_SSE2_KERNELS)
+            case SimdLevel::Sse2:
+                return Kernels<Sse2Ops, ScalarOps>::TABLE;
+#endif
+            default:
+                return Kernels<ScalarOps, ScalarOps>::TABLE;
+            }
+        }
+
+        void CheckInput(std::size_t inputSize, std::span<double> out)
+        {
+            if (inputSize < out.size())
+                throw std::invalid_argument(
+                    "Вхідний стовпець коротший за масив результатів.");
+        }
+    }
+
+    SimdLevel DetectSimdLevel()
+    {
+#if defined(COURSEWORK_AVX2_KERNELS)
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+#endif
+#if defined(COURSEWORK_SSE2_KERNELS)
+        return SimdLevel::Sse2;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    SimdLevel ActiveSimdLevel()
+    {
+        return ActiveLevel().load(std::memory_order_relaxed);
+    }
+
+    SimdLevel SetSimdLevel(SimdLevel level)
+    {
+        const SimdLevel best = DetectSimdLevel();
+        const SimdLevel applied = level > best ? best : level;
+        ActiveLevel().store(applied, std::memory_order_relaxed);
+        return applied;
+    }
+
+    std::string_view SimdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+        case SimdLevel::Avx2: return "avx2";
+        case SimdLevel::Sse2: return "sse2";
+        default: return "scalar";
+        }
+    }
+
+    void SavePercentages(std::span<const std::int32_t> saves,
+                         std::span<const std::int32_t> goalsConceded,
+                         std::span<double> out)
+    {
+        CheckInput(std::min(saves.size(), goalsConceded.size()), out);
+        Table().savePercentages(saves, goalsConceded, out);
+    }
+
+    void ConversionRates(std::span<const std::int32_t> goals,
+                         std::span<const std::int32_t> shots,
+                         std::span<double> out)
+    {
+        CheckInput(std::min(goals.size(), shots.size()), out);
+        Table().conversionRates(goals, shots, out);
+    }
+
+    void GoalkeeperRatings(const GoalkeeperStatColumns& stats,
+                           std::span<double> out)
+    {
+        CheckInput(std::min({stats.matchesPlayed.size(), stats.saves.size(),
+                             stats.cleanSheets.size(), stats.goalsConceded.size(),
+                             stats.penaltiesSaved.size()}), out);
+        Table().goalkeeperRatings(stats, out);
+    }
+
+    void FreeAgentRatings(std::span<const std::int32_t> monthsWithoutClub,
+                          std::span<double> out)
+    {
+        CheckInput(monthsWithoutClub.size(), out);
+        Table().freeAgentRatings(monthsWithoutClub, out);
+    }
+
+    void GoalkeeperValues(std::span<const double> marketValues,
+                          std::span<const double> ratings,
+                          std::span<const std::int32_t> cleanSheets,
+                          std::span<double> out)
+    {
+        CheckInput(std::min({marketValues.size(), ratings.size(),
+                             cleanSheets.size()}), out);
+        Table().goalkeeperValues(marketValues, ratings, cleanSheets, out);
+    }
+
+    void FreeAgentValues(std::span<const double> marketValues,
+                         std::span<const std::int32_t> monthsWithoutClub,
+                         std::span<double> out)
+    {
+        CheckInput(std::min(marketValues.size(), monthsWithoutClub.size()), out);
+        Table().freeAgentValues(marketValues, monthsWithoutClub, out);
+    }
+
+    void ContractedValues(std::span<const double> marketValues,
+                          std::span<const double> ratings,
+                          std::span<const double> salaries,
+                          std::span<double> out)
+    {
+        CheckInput(std::min({marketValues.size(), ratings.size(),
+                             salaries.size()}), out);
+        Table().contractedValues(marketValues, ratings, salaries, out);
+    }
+}
@@ -0,0 +1,69 @@
+// Збирається з -mavx2 (див. CMakeLists.txt) і викликається лише тоді, коли
+// процесор підтримує AVX2 (DetectSimdLevel).
+#include "RatingKernelsImpl.h"
+#include <immintrin.h>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        /**
+         * @brief Скалярний хвіст; окрема копія, бо ця одиниця трансляції
+         * зібрана з іншими прапорцями.
+         */
+        struct ScalarOps
+        {
+            using V = double;
+            using M = bool;
+            static constexpr std::size_t WIDTH = 1;
+
+            static V LoadInt(const std::int32_t* p) { return static_cast<double>(*p); }
+            static V Load(const double* p) { return *p; }
+            static void Store(double* p, V v) { *p = v; }
+            static V Set(double value) { return value; }
+            static V Add(V a, V b) { return a + b; }
+            static V Sub(V a, V b) { return a - b; }
+            static V Mul(V a, V b) { return a * b; }
+            static V Div(V a, V b) { return a / b; }
+            static M Eq(V a, V b) { return a == b; }
+            static M Lt(V a, V b) { return a < b; }
+            static V Select(M mask, V ifTrue, V ifFalse) { return mask ? ifTrue : ifFalse; }
+        };
+
+        /**
+         * @brief Операції AVX2: чотири значення double за інструкцію.
+         */
+        struct Avx2Ops
+        {
+            using V = __m256d;
+            using M = __m256d;
+            static constexpr std::size_t WIDTH = 4;
+
+            static V LoadInt(const std::int32_t* p)
+            {
+                return _mm256_cvtepi32_pd(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            }
+
+            static V Load(const double* p) { return _mm256_loadu_pd(p); }
+            static void Store(double* p, V v) { _mm256_storeu_pd(p, v); }
+            static V Set(double value) { return _mm256_set1_pd(value); }
+            static V Add(V a, V b) { return _mm256_add_pd(a, b); }
+            static V Sub(V a, V b) { return _mm256_sub_pd(a, b); }
+            static V Mul(V a, V b) { return _mm256_mul_pd(a, b); }
+            static V Div(V a, V b) { return _mm256_div_pd(a, b); }
+            static M Eq(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+            static M Lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+
+            static V Select(M mask, V ifTrue, V ifFalse)
+            {
+                return _mm256_blendv_pd(ifFalse, ifTrue, mask);
+            }
+        };
+    }
+
+    const RatingKernelsImpl::KernelTable& RatingKernelsImpl::Avx2Kernels()
+    {
+        return RatingKernelsImpl::Kernels<Avx2Ops, ScalarOps>::TABLE;
+    }
+}
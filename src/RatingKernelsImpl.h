@@ -0,0 +1,216 @@
+#pragma once
+
+// Внутрішній заголовок: спільні шаблони ядер для RatingKernels.cpp і
+// RatingKernelsAvx2.cpp. Кожна одиниця трансляції підставляє свої набори
+// операцій (Ops), визначені в анонімному просторі імен, тож екземпляри
+// шаблонів, зібрані з різними прапорцями компілятора, не змішуються.
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "../include/RatingKernels.h"
+
+namespace FootballManagement::RatingKernelsImpl
+{
+    /**
+     * @brief Таблиця ядер одного рівня SimdLevel.
+     */
+    struct KernelTable
+    {
+        void (*savePercentages)(std::span<const std::int32_t>,
+                                std::span<const std::int32_t>, std::span<double>);
+        void (*conversionRates)(std::span<const std::int32_t>,
+                                std::span<const std::int32_t>, std::span<double>);
+        void (*goalkeeperRatings)(const GoalkeeperStatColumns&, std::span<double>);
+        void (*freeAgentRatings)(std::span<const std::int32_t>, std::span<double>);
+        void (*goalkeeperValues)(std::span<const double>, std::span<const double>,
+                                 std::span<const std::int32_t>, std::span<double>);
+        void (*freeAgentValues)(std::span<const double>,
+                                std::span<const std::int32_t>, std::span<double>);
+        void (*contractedValues)(std::span<const double>, std::span<const double>,
+                                 std::span<const double>, std::span<double>);
+    };
+
+    /** @brief Ядра AVX2 (визначені лише у збірках для x86-64). */
+    const KernelTable& Avx2Kernels();
+
+    /**
+     * @brief Формули гравців, записані через операції Ops.
+     *
+     * Ops::V — вектор із Ops::WIDTH значень double, Ops::M — маска.
+     * Порядок операцій повторює методи класів, щоб результат збігався побітово.
+     */
+    template <typename Ops>
+    struct Formulas
+    {
+        using V = typename Ops::V;
+
+        static V Percentage(V part, V total)
+        {
+            const V zero = Ops::Set(0.0);
+            return Ops::Select(Ops::Eq(total, zero), zero,
+                               Ops::Mul(Ops::Div(part, total), Ops::Set(100.0)));
+        }
+
+        static V SavePercentage(V saves, V goalsConceded)
+        {
+            return Percentage(saves, Ops::Add(saves, goalsConceded));
+        }
+
+        static V GoalkeeperRating(V matches, V saves, V cleanSheets,
+                                  V goalsConceded, V penaltiesSaved)
+        {
+            const V zero = Ops::Set(0.0);
+            const V saveFactor = Ops::Div(SavePercentage(saves, goalsConceded),
+                                          Ops::Set(10.0));
+            const V goalPenalty = Ops::Div(goalsConceded, matches);
+            V rating = Ops::Add(Ops::Mul(cleanSheets, Ops::Set(4.0)),
+                                Ops::Mul(penaltiesSaved, Ops::Set(3.0)));
+            rating = Ops::Add(rating, saveFactor);
+            rating = Ops::Sub(rating, Ops::Mul(goalPenalty, Ops::Set(2.0)));
+            rating = Ops::Select(Ops::Lt(rating, zero), zero, rating);
+            return Ops::Select(Ops::Eq(matches, zero), zero, rating);
+        }
+
+        static V FreeAgentRating(V months)
+        {
+            // std::max(40.0, rating): 40 повертається і при рівності.
+            const V floor = Ops::Set(40.0);
+            const V rating = Ops::Sub(Ops::Set(70.0),
+                                      Ops::Mul(months, Ops::Set(1.2)));
+            return Ops::Select(Ops::Lt(floor, rating), rating, floor);
+        }
+
+        static V GoalkeeperValue(V marketValue, V rating, V cleanSheets)
+        {
+            const V withBonus = Ops::Add(marketValue,
+                                         Ops::Mul(rating, Ops::Set(100000.0)));
+            return Ops::Add(withBonus, Ops::Mul(cleanSheets, Ops::Set(300000.0)));
+        }
+
+        static V FreeAgentValue(V marketValue, V months)
+        {
+            const V floor = Ops::Set(0.5);
+            const V penalty = Ops::Sub(Ops::Set(1.0),
+                                       Ops::Mul(months, Ops::Set(0.05)));
+            return Ops::Mul(marketValue,
+                            Ops::Select(Ops::Lt(floor, penalty), penalty, floor));
+        }
+
+        static V ContractedValue(V marketValue, V rating, V salary)
+        {
+            const V withBonus = Ops::Add(marketValue,
+                                         Ops::Mul(rating, Ops::Set(50000.0)));
+            return Ops::Add(withBonus, Ops::Div(salary, Ops::Set(10000.0)));
+        }
+    };
+
+    /**
+     * @brief Проходить out кроками Ops::WIDTH, хвіст — скалярними операціями.
+     * @param compute Узагальнена лямбда: compute.template operator()<O>(i) повертає O::V.
+     */
+    template <typename Ops, typename ScalarOps, typename Compute>
+    void Apply(std::span<double> out, const Compute& compute)
+    {
+        std::size_t i = 0;
+        for (; i + Ops::WIDTH <= out.size(); i += Ops::WIDTH)
+            Ops::Store(out.data() + i, compute.template operator()<Ops>(i));
+        for (; i < out.size(); ++i)
+            ScalarOps::Store(out.data() + i,
+                             compute.template operator()<ScalarOps>(i));
+    }
+
+    /**
+     * @brief Ядра всіх формул для пари наборів операцій (вектор + скалярний хвіст).
+     */
+    template <typename Ops, typename ScalarOps>
+    struct Kernels
+    {
+        static void SavePercentages(std::span<const std::int32_t> saves,
+                                    std::span<const std::int32_t> goalsConceded,
+                                    std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::SavePercentage(O::LoadInt(&saves[i]),
+                                                   O::LoadInt(&goalsConceded[i]));
+            });
+        }
+
+        static void ConversionRates(std::span<const std::int32_t> goals,
+                                    std::span<const std::int32_t> shots,
+                                    std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::Percentage(O::LoadInt(&goals[i]),
+                                               O::LoadInt(&shots[i]));
+            });
+        }
+
+        static void GoalkeeperRatings(const GoalkeeperStatColumns& stats,
+                                      std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::GoalkeeperRating(
+                    O::LoadInt(&stats.matchesPlayed[i]), O::LoadInt(&stats.saves[i]),
+                    O::LoadInt(&stats.cleanSheets[i]),
+                    O::LoadInt(&stats.goalsConceded[i]),
+                    O::LoadInt(&stats.penaltiesSaved[i]));
+            });
+        }
+
+        static void FreeAgentRatings(std::span<const std::int32_t> months,
+                                     std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::FreeAgentRating(O::LoadInt(&months[i]));
+            });
+        }
+
+        static void GoalkeeperValues(std::span<const double> marketValues,
+                                     std::span<const double> ratings,
+                                     std::span<const std::int32_t> cleanSheets,
+                                     std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::GoalkeeperValue(O::Load(&marketValues[i]),
+                                                    O::Load(&ratings[i]),
+                                                    O::LoadInt(&cleanSheets[i]));
+            });
+        }
+
+        static void FreeAgentValues(std::span<const double> marketValues,
+                                    std::span<const std::int32_t> months,
+                                    std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::FreeAgentValue(O::Load(&marketValues[i]),
+                                                   O::LoadInt(&months[i]));
+            });
+        }
+
+        static void ContractedValues(std::span<const double> marketValues,
+                                     std::span<const double> ratings,
+                                     std::span<const double> salaries,
+                                     std::span<double> out)
+        {
+            Apply<Ops, ScalarOps>(out, [&]<typename O>(std::size_t i)
+            {
+                return Formulas<O>::ContractedValue(O::Load(&marketValues[i]),
+                                                    O::Load(&ratings[i]),
+                                                    O::Load(&salaries[i]));
+            });
+        }
+
+        static constexpr KernelTable TABLE = {
+            &SavePercentages, &ConversionRates, &GoalkeeperRatings,
+            &FreeAgentRatings, &GoalkeeperValues, &FreeAgentValues,
+            &ContractedValues
+        };
+    };
+}
@@ -0,0 +1,111 @@
+#include "../include/RecordParser.h"
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+namespace FootballManagement
+{
+    RecordParser::RecordParser(std::string_view record) noexcept :
+        record_(record), pos_(0)
+    {
+    }
+
+    bool RecordParser::Next(RecordField& field) noexcept
+    {
+        const char* data = record_.data();
+        const std::size_t size = record_.size();
+
+        while (pos_ < size)
+        {
+            const char c = data[pos_];
+            if (c == ',' || c == '{' || c == '}' || c == ' ')
+            {
+                ++pos_;
+                continue;
+            }
+
+            if (c != '"')
+            {
+                // Значення без ключа — пропускаємо до наступної коми.
+                const void* comma = std::memchr(data + pos_, ',', size - pos_);
+                pos_ = comma
+                           ? static_cast<const char*>(comma) - data + 1
+                           : size;
+                continue;
+            }
+
+            const std::size_t keyBegin = pos_ + 1;
+            const void* keyEnd = std::memchr(data + keyBegin, '"',
+                                             size - keyBegin);
+            if (!keyEnd) return false;
+
+            const std::size_t keyEndPos = static_cast<const char*>(keyEnd) -
+                data;
+            std::size_t valuePos = keyEndPos + 1;
+            if (valuePos >= size || data[valuePos] != ':')
+            {
+                // Рядок у лапках без двокрапки — це значення без ключа.
+                pos_ = valuePos;
+                continue;
+            }
+            ++valuePos;
+
+            field.key = record_.substr(keyBegin, keyEndPos - keyBegin);
+
+            if (valuePos < size && data[valuePos] == '"')
+            {
+                const std::size_t valueBegin = valuePos + 1;
+                const void* valueEnd = std::memchr(data + valueBegin, '"',
+                                                   size - valueBegin);
+                const std::size_t valueEndPos = valueEnd
+                                                    ? static_cast<const char*>(
+                                                        valueEnd) - data
+                                                    : size;
+                field.value = record_.substr(valueBegin,
+                                             valueEndPos - valueBegin);
+                pos_ = valueEndPos + 1;
+            }
+            else
+            {
+                std::size_t valueEndPos = valuePos;
+                while (valueEndPos < size && data[valueEndPos] != ',' &&
+                    data[valueEndPos] != '}')
+                    ++valueEndPos;
+                field.value = record_.substr(valuePos, valueEndPos - valuePos);
+                pos_ = valueEndPos;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    int RecordParser::ParseInt(std::string_view value)
+    {
+        int result = 0;
+        const auto [ptr, ec] = std::from_chars(value.data(),
+                                               value.data() + value.size(),
+                                               result);
+        // Значення має бути числом повністю: "12abc" — помилка, а не 12.
+        if (ec != std::errc() || ptr == value.data() ||
+            ptr != value.data() + value.size())
+            throw std::invalid_argument("Некоректне ціле число у записі.");
+        return result;
+    }
+
+    double RecordParser::ParseDouble(std::string_view value)
+    {
+        double result = 0.0;
+        const auto [ptr, ec] = std::from_chars(value.data(),
+                                               value.data() + value.size(),
+                                               result);
+        if (ec != std::errc() || ptr == value.data() ||
+            ptr != value.data() + value.size())
+            throw std::invalid_argument("Некоректне дійсне число у записі.");
+        return result;
+    }
+
+    bool RecordParser::ParseBool(std::string_view value) noexcept
+    {
+        return value == "true" || value == "1";
+    }
+}
@@ -0,0 +1,132 @@
+#include "../include/RecordReader.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+namespace FootballManagement
+{
+    RecordReader::RecordReader(const std::string& fullPath,
+                               std::size_t bufferBytes,
+                               ReadProgressCallback onProgress) :
+        // Перший блок має вмістити сигнатуру бінарного знімка (див. Peek).
+        buffer_(std::max<std::size_t>(bufferBytes, 64), '\0'),
+        eof_(false), onProgress_(std::move(onProgress))
+    {
+        // Блоки читаються прямо в buffer_ — буфер потоку лише дублював би їх.
+        file_.rdbuf()->pubsetbuf(nullptr, 0);
+        file_.open(fullPath, std::ios::in | std::ios::binary);
+        if (!file_.is_open())
+            throw std::runtime_error("Не вдалося відкрити файл для читання.");
+
+        std::error_code ignored;
+        const auto size = std::filesystem::file_size(fullPath, ignored);
+        progress_.totalBytes = ignored ? 0 : static_cast<std::uint64_t>(size);
+
+        Refill();
+
+        // Кількість записів оцінюється за щільністю рядків у першому блоці.
+        const auto lines = static_cast<std::size_t>(
+            std::count(buffer_.begin(), buffer_.begin() + end_, '\n')) + 1;
+        sizeHint_ = eof_ || end_ == 0
+                        ? lines
+                        : static_cast<std::size_t>(
+                            static_cast<double>(lines) * progress_.totalBytes / end_);
+    }
+
+    RecordReader RecordReader::Unreadable()
+    {
+        RecordReader reader;
+        reader.failed_ = true;
+        return reader;
+    }
+
+    bool RecordReader::Refill()
+    {
+        if (eof_ || cancelled_ || failed_) return false;
+
+        // Незавершений рядок переноситься на початок; якщо він займає весь
+        // буфер, буфер подвоюється (запис довший за блок).
+        const std::size_t pending = end_ - begin_;
+        if (pending > 0 && begin_ > 0)
+            std::memmove(buffer_.data(), buffer_.data() + begin_, pending);
+        begin_ = 0;
+        end_ = pending;
+        if (end_ == buffer_.size())
+            buffer_.resize(buffer_.size() * 2);
+
+        file_.read(buffer_.data() + end_,
+                   static_cast<std::streamsize>(buffer_.size() - end_));
+        // Короткий блок — кінець файлу лише без badbit; інакше записи,
+        // що лишилися в буфері, не віддаються, щоб не прийняти обрізаний файл.
+        if (file_.bad())
+        {
+            failed_ = true;
+            eof_ = true;
+            begin_ = end_ = 0;
+            return false;
+        }
+        const auto count = static_cast<std::size_t>(file_.gcount());
+        if (count < buffer_.size() - end_) eof_ = true;
+        end_ += count;
+        progress_.bytesRead += count;
+
+        if (onProgress_ && !onProgress_(progress_))
+        {
+            cancelled_ = true;
+            eof_ = true;
+            begin_ = end_ = 0;
+            return false;
+        }
+        return count > 0;
+    }
+
+    bool RecordReader::NextRecord(std::string_view& record)
+    {
+        for (;;)
+        {
+            const char* data = buffer_.data();
+            const char* newline = static_cast<const char*>(
+                std::memchr(data + begin_, '\n', end_ - begin_));
+
+            std::size_t lineEnd = 0;
+            std::size_t next = 0;
+            if (newline)
+            {
+                lineEnd = static_cast<std::size_t>(newline - data);
+                next = lineEnd + 1;
+            }
+            else if (!Refill())
+            {
+                // Останній рядок без '\n' (або кінець даних).
+                if (begin_ == end_) return false;
+                lineEnd = end_;
+                next = end_;
+            }
+            else
+            {
+                continue;
+            }
+
+            std::string_view line(buffer_.data() + begin_, lineEnd - begin_);
+            begin_ = next;
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            if (line.empty()) continue;
+
+            record = line;
+            ++progress_.records;
+            return true;
+        }
+    }
+
+    std::size_t RecordReader::SizeHint() const
+    {
+        return sizeHint_;
+    }
+
+    std::string_view RecordReader::Peek() const
+    {
+        return {buffer_.data() + begin_, end_ - begin_};
+    }
+}
@@ -0,0 +1,52 @@
+#include "../include/RecordSink.h"
+#include <stdexcept>
+
+namespace FootballManagement
+{
+    RecordSink::RecordSink(std::size_t flushBytes) : flushBytes_(flushBytes)
+    {
+        // Запас на один запис понад порцію, щоб буфер не ріс у процесі.
+        buffer_.Reserve(flushBytes_ + 4096);
+    }
+
+    void RecordSink::Write(std::string_view data)
+    {
+        if (data.size() < flushBytes_)
+        {
+            buffer_.Append(data);
+            EndRecord();
+            return;
+        }
+
+        Flush();
+        WriteChunk(data);
+        bytesWritten_ += data.size();
+    }
+
+    void RecordSink::Flush()
+    {
+        if (buffer_.Empty()) return;
+
+        WriteChunk(buffer_.View());
+        bytesWritten_ += buffer_.Size();
+        buffer_.Clear();
+    }
+
+    FileRecordSink::FileRecordSink(const std::string& path,
+                                   std::size_t flushBytes) :
+        RecordSink(flushBytes), file_(path, DurableFile::Mode::Truncate)
+    {
+    }
+
+    void FileRecordSink::WriteChunk(std::string_view chunk)
+    {
+        file_.Write(chunk);
+    }
+
+    void FileRecordSink::Close()
+    {
+        Flush();
+        file_.Sync();
+        file_.Close();
+    }
+}
@@ -0,0 +1,104 @@
+#include "../include/RecordSources.h"
+#include <algorithm>
+#include <cstring>
+
+namespace FootballManagement
+{
+    VectorRecordSource::VectorRecordSource(
+        const std::vector<std::string>& lines) : lines_(lines), index_(0)
+    {
+    }
+
+    bool VectorRecordSource::NextRecord(std::string_view& record)
+    {
+        while (index_ < lines_.size())
+        {
+            const std::string& line = lines_[index_++];
+            if (!line.empty())
+            {
+                record = line;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t VectorRecordSource::SizeHint() const
+    {
+        return lines_.size();
+    }
+
+    LineRange::Iterator::Iterator(std::string_view data, std::size_t pos) :
+        data_(data), pos_(pos)
+    {
+        Advance();
+    }
+
+    void LineRange::Iterator::Advance()
+    {
+        while (pos_ < data_.size())
+        {
+            const char* begin = data_.data() + pos_;
+            const void* newline = std::memchr(begin, '\n', data_.size() - pos_);
+            const std::size_t end = newline
+                                        ? static_cast<const char*>(newline) -
+                                        data_.data()
+                                        : data_.size();
+
+            std::size_t length = end - pos_;
+            if (length > 0 && begin[length - 1] == '\r') --length;
+            pos_ = end + 1;
+
+            if (length > 0)
+            {
+                line_ = std::string_view(begin, length);
+                return;
+            }
+        }
+        line_ = std::string_view();
+    }
+
+    LineRange::Iterator& LineRange::Iterator::operator++()
+    {
+        Advance();
+        return *this;
+    }
+
+    LineRange::Iterator LineRange::Iterator::operator++(int)
+    {
+        Iterator copy = *this;
+        Advance();
+        return copy;
+    }
+
+    LineRange::LineRange(std::string_view data) : data_(data), cursor_(0)
+    {
+    }
+
+    LineRange::Iterator LineRange::begin() const
+    {
+        return Iterator(data_, 0);
+    }
+
+    LineRange::Iterator LineRange::end() const
+    {
+        return Iterator();
+    }
+
+    bool LineRange::NextRecord(std::string_view& record)
+    {
+        Iterator it(data_, cursor_);
+        if (it == end()) return false;
+
+        record = *it;
+        cursor_ = static_cast<std::size_t>(record.data() - data_.data()) +
+            record.size() + 1;
+        return true;
+    }
+
+    std::size_t LineRange::SizeHint() const
+    {
+        return static_cast<std::size_t>(
+            std::count(data_.begin(), data_.end(), '\n')) + 1;
+    }
+}
@@ -0,0 +1,218 @@
+#include "../include/RosterColumns.h"
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        std::size_t IntIndex(RosterColumn column)
+        {
+            if (!IsIntColumn(column))
+                throw std::invalid_argument("Стовпець не є цілочисельним.");
+            return static_cast<std::size_t>(column);
+        }
+
+        std::size_t DoubleIndex(RosterColumn column)
+        {
+            if (IsIntColumn(column))
+                throw std::invalid_argument("Стовпець не є дійсним.");
+            return static_cast<std::size_t>(column) - INT_COLUMN_COUNT;
+        }
+
+        template <typename T>
+        void RemoveAt(std::vector<T>& column, std::size_t slot)
+        {
+            column.erase(column.begin() + static_cast<std::ptrdiff_t>(slot));
+        }
+
+        template <typename T>
+        ColumnSummary SummarizeValues(std::span<const T> values)
+        {
+            ColumnSummary summary;
+            summary.count = values.size();
+            if (values.empty()) return summary;
+
+            // Чотири незалежні суми розривають ланцюжок залежностей додавання,
+            // а мінімум і максимум компілятор векторизує сам.
+            using Sum = std::conditional_t<std::is_integral_v<T>, long long,
+                                           double>;
+            Sum sums[4] = {};
+            T low = values[0];
+            T high = values[0];
+            std::size_t i = 0;
+            for (; i + 4 <= values.size(); i += 4)
+            {
+                for (std::size_t lane = 0; lane < 4; ++lane)
+                {
+                    const T value = values[i + lane];
+                    sums[lane] += value;
+                    low = value < low ? value : low;
+                    high = value > high ? value : high;
+                }
+            }
+            for (; i < values.size(); ++i)
+            {
+                sums[0] += values[i];
+                low = values[i] < low ? values[i] : low;
+                high = values[i] > high ? values[i] : high;
+            }
+
+            summary.sum = static_cast<double>(sums[0] + sums[1] + sums[2] +
+                sums[3]);
+            summary.min = static_cast<double>(low);
+            summary.max = static_cast<double>(high);
+            return summary;
+        }
+
+        template <typename T>
+        std::vector<int> TopValues(std::span<const T> values,
+                                   std::span<const int> playerIds,
+                                   std::size_t k, bool descending)
+        {
+            using Candidate = std::pair<T, int>;
+            const auto better = [descending](const Candidate& a,
+                                             const Candidate& b)
+            {
+                if (a.first != b.first)
+                    return descending ? a.first > b.first : a.first < b.first;
+                return a.second < b.second;
+            };
+
+            // Купа тримає k найкращих; на вершині — найгірший з них, тож
+            // більшість елементів відсікається одним порівнянням.
+            std::vector<Candidate> heap;
+            heap.reserve(std::min(k, values.size()));
+            for (std::size_t i = 0; i < values.size() && k > 0; ++i)
+            {
+                const Candidate candidate{values[i], playerIds[i]};
+                if (heap.size() < k)
+                {
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end(), better);
+                }
+                else if (better(candidate, heap.front()))
+                {
+                    std::pop_heap(heap.begin(), heap.end(), better);
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end(), better);
+                }
+            }
+            std::sort_heap(heap.begin(), heap.end(), better);
+
+            std::vector<int> ids;
+            ids.reserve(heap.size());
+            for (const Candidate& candidate : heap) ids.push_back(candidate.second);
+            return ids;
+        }
+    }
+
+    std::int32_t& RosterRow::Int(RosterColumn column)
+    {
+        return ints[IntIndex(column)];
+    }
+
+    double& RosterRow::Double(RosterColumn column)
+    {
+        return doubles[DoubleIndex(column)];
+    }
+
+    double ColumnSummary::Mean() const
+    {
+        return count == 0 ? 0.0 : sum / static_cast<double>(count);
+    }
+
+    void RosterColumns::PushBack(const RosterRow& row)
+    {
+        playerIds_.push_back(row.playerId);
+        positions_.push_back(row.position);
+        kinds_.push_back(row.kind);
+        for (std::size_t c = 0; c < INT_COLUMN_COUNT; ++c)
+            ints_[c].push_back(row.ints[c]);
+        for (std::size_t c = 0; c < DOUBLE_COLUMN_COUNT; ++c)
+            doubles_[c].push_back(row.doubles[c]);
+    }
+
+    void RosterColumns::Set(std::size_t slot, const RosterRow& row)
+    {
+        playerIds_[slot] = row.playerId;
+        positions_[slot] = row.position;
+        kinds_[slot] = row.kind;
+        for (std::size_t c = 0; c < INT_COLUMN_COUNT; ++c)
+            ints_[c][slot] = row.ints[c];
+        for (std::size_t c = 0; c < DOUBLE_COLUMN_COUNT; ++c)
+            doubles_[c][slot] = row.doubles[c];
+    }
+
+    void RosterColumns::Remove(std::size_t slot)
+    {
+        RemoveAt(playerIds_, slot);
+        RemoveAt(positions_, slot);
+        RemoveAt(kinds_, slot);
+        for (auto& column : ints_) RemoveAt(column, slot);
+        for (auto& column : doubles_) RemoveAt(column, slot);
+    }
+
+    void RosterColumns::Clear()
+    {
+        playerIds_.clear();
+        positions_.clear();
+        kinds_.clear();
+        for (auto& column : ints_) column.clear();
+        for (auto& column : doubles_) column.clear();
+    }
+
+    void RosterColumns::Reserve(std::size_t count)
+    {
+        playerIds_.reserve(count);
+        positions_.reserve(count);
+        kinds_.reserve(count);
+        for (auto& column : ints_) column.reserve(count);
+        for (auto& column : doubles_) column.reserve(count);
+    }
+
+    std::size_t RosterColumns::Size() const { return playerIds_.size(); }
+
+    std::span<const int> RosterColumns::PlayerIds() const { return playerIds_; }
+
+    std::span<const Position> RosterColumns::Positions() const
+    {
+        return positions_;
+    }
+
+    std::span<const std::uint8_t> RosterColumns::Kinds() const { return kinds_; }
+
+    std::span<const std::int32_t> RosterColumns::Ints(RosterColumn column) const
+    {
+        return ints_[IntIndex(column)];
+    }
+
+    std::span<const double> RosterColumns::Doubles(RosterColumn column) const
+    {
+        return doubles_[DoubleIndex(column)];
+    }
+
+    double RosterColumns::Value(RosterColumn column, std::size_t slot) const
+    {
+        return IsIntColumn(column)
+                   ? ints_[IntIndex(column)][slot]
+                   : doubles_[DoubleIndex(column)][slot];
+    }
+
+    ColumnSummary RosterColumns::Summarize(RosterColumn column) const
+    {
+        return IsIntColumn(column)
+                   ? SummarizeValues(Ints(column))
+                   : SummarizeValues(Doubles(column));
+    }
+
+    std::vector<int> RosterColumns::TopK(RosterColumn column, std::size_t k,
+                                         bool descending) const
+    {
+        return IsIntColumn(column)
+                   ? TopValues(Ints(column), PlayerIds(), k, descending)
+                   : TopValues(Doubles(column), PlayerIds(), k, descending);
+    }
+}
@@ -0,0 +1,213 @@
+#include "../include/RosterJournal.h"
+#include "../include/ClubManager.h"
+#include "../include/RecordParser.h"
+#include <iostream>
+#include <stdexcept>
+
+namespace FootballManagement
+{
+    RosterJournal::RosterJournal(const FileManager& fileManager,
+                                 std::size_t compactionThreshold,
+                                 const std::string& snapshotFile,
+                                 const std::string& journalFile) :
+        fileManager_(fileManager), snapshotFile_(snapshotFile),
+        journalFile_(journalFile), compactionThreshold_(compactionThreshold),
+        entryCount_(0)
+    {
+        if (compactionThreshold_ == 0)
+            throw std::invalid_argument(
+                "Поріг ущільнення журналу повинен бути додатним.");
+    }
+
+    bool RosterJournal::OpenForAppend()
+    {
+        if (out_.IsOpen()) return true;
+        if (!fileManager_.EnsureDirectoryExists()) return false;
+
+        try
+        {
+            out_.Open(fileManager_.GetFullPath(journalFile_),
+                      DurableFile::Mode::Append);
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    std::unique_lock<std::recursive_mutex> RosterJournal::Lock() const
+    {
+        return std::unique_lock(mutex_);
+    }
+
+    bool RosterJournal::Append(std::string_view op, std::string_view payload,
+                               bool sync)
+    {
+        const auto lock = Lock();
+        if (recoveryFailed_)
+        {
+            // Склад у пам'яті неповний: його записи (ID від FIRST_PLAYER_ID,
+            // бюджет) при наступному Recover перекрили б справжній склад.
+            std::cout << "[ПОМИЛКА] Зміну не записано в журнал " << journalFile_
+                << ": склад не було відновлено з диска." << std::endl;
+            return false;
+        }
+        if (!OpenForAppend())
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося відкрити журнал " << journalFile_
+                << " для запису." << std::endl;
+            return false;
+        }
+
+        line_.Clear();
+        line_.Append(op).Append(' ')
+             .AppendInt(static_cast<long long>(payload.size())).Append(' ')
+             .Append(payload).Append('\n');
+
+        try
+        {
+            out_.Write(line_.View());
+            if (sync) out_.Sync();
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося записати зміну в журнал: " <<
+                e.what() << std::endl;
+            return false;
+        }
+
+        ++entryCount_;
+        return true;
+    }
+
+    bool RosterJournal::Sync()
+    {
+        const auto lock = Lock();
+        if (!out_.IsOpen()) return true;
+
+        try
+        {
+            out_.Sync();
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося скинути журнал на диск: " <<
+                e.what() << std::endl;
+            return false;
+        }
+    }
+
+    std::size_t RosterJournal::GetEntryCount() const
+    {
+        const auto lock = Lock();
+        return entryCount_;
+    }
+
+    bool RosterJournal::NeedsCompaction() const
+    {
+        const auto lock = Lock();
+        return entryCount_ >= compactionThreshold_;
+    }
+
+    bool RosterJournal::Compact(const ISnapshotHandler& snapshot)
+    {
+        return CompactWith([&]
+        {
+            return fileManager_.SaveSnapshot(snapshotFile_, snapshot);
+        });
+    }
+
+    bool RosterJournal::Compact(const RosterSnapshot& roster)
+    {
+        return CompactWith([&]
+        {
+            return fileManager_.SaveSnapshot(snapshotFile_, roster);
+        });
+    }
+
+    bool RosterJournal::CompactWith(const std::function<bool()>& saveSnapshot)
+    {
+        const auto lock = Lock();
+        if (recoveryFailed_)
+        {
+            std::cout << "[ПОМИЛКА] Знімок " << snapshotFile_ << " не перезаписано: "
+                "склад не було відновлено з диска." << std::endl;
+            return false;
+        }
+        if (!saveSnapshot()) return false;
+
+        // Знімок уже атомарно замінено, тож журнал можна очистити.
+        // Збій між цими кроками безпечний: програвання журналу ідемпотентне.
+        try
+        {
+            out_.Open(fileManager_.GetFullPath(journalFile_),
+                      DurableFile::Mode::Truncate);
+            out_.Sync();
+            out_.Close();
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "[ПОМИЛКА] Не вдалося очистити журнал: " << e.what()
+                << std::endl;
+            return false;
+        }
+        entryCount_ = 0;
+
+        std::cout << "[ІНФО] Журнал змін ущільнено у знімок " << snapshotFile_
+            << "." << std::endl;
+        return true;
+    }
+
+    void RosterJournal::Recover(ClubManager& clubManager)
+    {
+        const auto lock = Lock();
+        recoveryFailed_ = !fileManager_.LoadSnapshot(snapshotFile_, clubManager);
+        if (recoveryFailed_)
+            throw std::runtime_error("Знімок " + snapshotFile_ +
+                " не завантажено; відновлення перервано, щоб не перезаписати його.");
+
+        if (!fileManager_.FileExists(journalFile_)) return;
+
+        std::size_t replayed = 0;
+        {
+            RecordReader journalRecords = fileManager_.ReadRecords(journalFile_);
+            replayed = clubManager.ReplayJournal(journalRecords);
+            // Недочитаний журнал не ущільнюється: знімок втратив би решту змін.
+            recoveryFailed_ = journalRecords.Failed();
+        }
+        if (recoveryFailed_)
+            throw std::runtime_error("Журнал " + journalFile_ +
+                " не прочитано до кінця; відновлення перервано.");
+
+        std::cout << "[ІНФО] Програно записів журналу: " << replayed << "." <<
+            std::endl;
+        if (replayed > 0) Compact(clubManager);
+    }
+
+    bool RosterJournal::ParseEntry(std::string_view entry, std::string_view& op,
+                                   std::string_view& payload)
+    {
+        const std::size_t opEnd = entry.find(' ');
+        if (opEnd == std::string_view::npos) return false;
+
+        const std::size_t lengthEnd = entry.find(' ', opEnd + 1);
+        if (lengthEnd == std::string_view::npos) return false;
+
+        std::size_t length = 0;
+        try
+        {
+            length = static_cast<std::size_t>(RecordParser::ParseInt(
+                entry.substr(opEnd + 1, lengthEnd - opEnd - 1)));
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+
+        op = entry.substr(0, opEnd);
+        payload = entry.substr(lengthEnd + 1);
+        return payload.size() == length;
+    }
+}
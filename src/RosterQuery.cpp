@@ -0,0 +1,161 @@
+#include "../include/RosterQuery.h"
+#include "../include/ClubManager.h"
+#include "../include/TextFolding.h"
+#include <algorithm>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        /**
+         * @brief Поєднує через І дві умови статусу, кожна з яких — АБО фільтрів.
+         */
+        std::vector<StatusFilter> IntersectStatus(
+            const std::vector<StatusFilter>& left,
+            const std::vector<StatusFilter>& right)
+        {
+            std::vector<StatusFilter> combined;
+            combined.reserve(left.size() * right.size());
+            for (const StatusFilter& a : left)
+            {
+                for (const StatusFilter& b : right)
+                    combined.push_back({a.required | b.required,
+                                        a.excluded | b.excluded});
+            }
+            return combined;
+        }
+    }
+
+    RosterQuery::RosterQuery(const ClubManager& club) : club_(club)
+    {
+    }
+
+    RosterQuery& RosterQuery::WhereAge(int minAge, int maxAge)
+    {
+        criteria_.minAge = minAge;
+        criteria_.maxAge = maxAge;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WherePosition(Position position)
+    {
+        criteria_.position = position;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WhereNationality(const std::string& nationality)
+    {
+        criteria_.nationality = FoldCase(nationality);
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WhereValue(double minValue, double maxValue)
+    {
+        criteria_.minValue = minValue;
+        criteria_.maxValue = maxValue;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WhereSalary(double minSalary, double maxSalary)
+    {
+        criteria_.minSalary = minSalary;
+        criteria_.maxSalary = maxSalary;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WhereInjured(bool injured)
+    {
+        return injured
+                   ? WhereStatus(PlayerStatus::Injured)
+                   : WhereStatus(PlayerStatus::None, PlayerStatus::Injured);
+    }
+
+    RosterQuery& RosterQuery::WhereStatus(PlayerStatus required,
+                                          PlayerStatus excluded)
+    {
+        const std::vector<StatusFilter> filter = {{required, excluded}};
+        criteria_.status = criteria_.status
+                               ? IntersectStatus(*criteria_.status, filter)
+                               : filter;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WhereStatus(const std::string& statusText)
+    {
+        const std::vector<StatusFilter> filters = ParseStatusQuery(statusText);
+        criteria_.status = criteria_.status
+                               ? IntersectStatus(*criteria_.status, filters)
+                               : filters;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::WhereNameContains(const std::string& nameQuery)
+    {
+        criteria_.nameContains = nameQuery;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::OrderBy(QueryOrder order, bool descending)
+    {
+        criteria_.order = order;
+        criteria_.descending = descending;
+        return *this;
+    }
+
+    RosterQuery& RosterQuery::Limit(std::size_t limit)
+    {
+        criteria_.limit = limit;
+        return *this;
+    }
+
+    const QueryCriteria& RosterQuery::Criteria() const { return criteria_; }
+
+    void RosterQuery::Run(const std::function<bool(const Player&)>& visit) const
+    {
+        club_.VisitQuery(criteria_, visit);
+    }
+
+    std::vector<int> RosterQuery::Ids() const
+    {
+        std::vector<int> ids;
+        Run([&ids](const Player& player)
+        {
+            ids.push_back(player.GetPlayerId());
+            return true;
+        });
+        return ids;
+    }
+
+    std::size_t RosterQuery::Count() const
+    {
+        // Лише умова статусу — відповідь дає підрахунок бітів без обходу гравців.
+        const bool statusOnly = criteria_.status && !criteria_.minAge &&
+            !criteria_.position && !criteria_.nationality &&
+            !criteria_.maxAge && !criteria_.minValue && !criteria_.maxValue &&
+            !criteria_.minSalary && !criteria_.maxSalary &&
+            !criteria_.nameContains;
+        if (statusOnly)
+        {
+            const std::size_t count = club_.CountByStatus(*criteria_.status);
+            return criteria_.limit == 0 ? count : std::min(count, criteria_.limit);
+        }
+
+        std::size_t count = 0;
+        Run([&count](const Player&)
+        {
+            ++count;
+            return true;
+        });
+        return count;
+    }
+
+    void RosterQuery::ForEach(
+        const std::function<void(const Player&)>& visit) const
+    {
+        Run([&visit](const Player& player)
+        {
+            visit(player);
+            return true;
+        });
+    }
+}
@@ -0,0 +1,109 @@
+#include "../include/RosterSnapshot.h"
+#include "../include/BinaryIO.h"
+#include <iostream>
+#include <utility>
+
+namespace FootballManagement
+{
+    RosterSnapshot::RosterSnapshot(
+        PersistentVector<std::shared_ptr<const Player>> players,
+        std::string clubName, double transferBudget, int nextId,
+        std::uint64_t version, std::shared_ptr<const void> lease) :
+        players_(std::move(players)), clubName_(std::move(clubName)),
+        transferBudget_(transferBudget), nextId_(nextId), version_(version),
+        lease_(std::move(lease))
+    {
+    }
+
+    std::uint64_t RosterSnapshot::Version() const { return version_; }
+
+    std::size_t RosterSnapshot::Size() const { return players_.Size(); }
+
+    const std::string& RosterSnapshot::GetClubName() const { return clubName_; }
+
+    double RosterSnapshot::GetTransferBudget() const { return transferBudget_; }
+
+    int RosterSnapshot::GetNextId() const { return nextId_; }
+
+    const Player& RosterSnapshot::At(std::size_t index) const
+    {
+        return *players_.At(index);
+    }
+
+    std::shared_ptr<const Player> RosterSnapshot::FindById(int playerId) const
+    {
+        std::shared_ptr<const Player> found;
+        players_.ForEach([&found, playerId](const std::shared_ptr<const Player>& player)
+        {
+            if (!found && player->GetPlayerId() == playerId) found = player;
+        });
+        return found;
+    }
+
+    SquadSummary RosterSnapshot::Summarize() const
+    {
+        SquadSummary summary;
+        double totalAge = 0.0;
+        ForEach([&summary, &totalAge](const Player& player)
+        {
+            ++summary.playerCount;
+            if (player.IsInjured()) ++summary.injuredCount;
+            totalAge += player.GetAge();
+            summary.totalMarketValue += player.GetMarketValue();
+            summary.totalValue += player.CalculateValue();
+        });
+        if (summary.playerCount > 0)
+            summary.averageAge = totalAge / static_cast<double>(summary.playerCount);
+        return summary;
+    }
+
+    void RosterSnapshot::ViewAllPlayers() const
+    {
+        std::cout << "\n=== СКЛАД КЛУБУ \"" << clubName_ << "\" ===" <<
+            std::endl;
+        if (players_.Empty())
+        {
+            std::cout << "Немає зареєстрованих гравців." << std::endl;
+            return;
+        }
+
+        ForEach([](const Player& player)
+        {
+            player.ShowInfo();
+            std::cout << "--------------------------------------------" <<
+                std::endl;
+        });
+    }
+
+    void RosterSnapshot::WriteTo(RecordSink& sink) const
+    {
+        sink.Buffer().Append(clubName_).Append(',').AppendDouble(transferBudget_)
+            .Append(',').AppendInt(nextId_).Append('\n');
+        sink.EndRecord();
+
+        ForEach([&sink](const Player& player)
+        {
+            player.AppendTo(sink.Buffer());
+            sink.Buffer().Append('\n');
+            sink.EndRecord();
+        });
+    }
+
+    std::string RosterSnapshot::SerializeBinary() const
+    {
+        BinaryWriter writer;
+        writer.WriteString(clubName_);
+        writer.WriteF64(transferBudget_);
+        writer.WriteI32(nextId_);
+        writer.WriteU64(players_.Size());
+
+        ForEach([&writer](const Player& player)
+        {
+            const std::size_t mark = writer.BeginRecord(
+                static_cast<std::uint8_t>(player.GetRecordTag()));
+            player.WriteBinary(writer);
+            writer.EndRecord(mark);
+        });
+        return writer.Finish();
+    }
+}
@@ -0,0 +1,201 @@
+#include "../include/SlabPool.h"
+#include <algorithm>
+
+namespace FootballManagement
+{
+    SlabArena::SlabArena() :
+        nodeSize_(0), alignment_(alignof(FreeNode)),
+        nextSlabNodes_(FIRST_SLAB_NODES), freeList_(nullptr), cursor_(nullptr),
+        slabEnd_(nullptr), reservedBytes_(0), liveNodes_(0)
+    {
+    }
+
+    bool SlabArena::FitsNode(std::size_t nodeSize, std::size_t size,
+                             std::size_t alignment) const
+    {
+        // alignment_ незмінний після публікації nodeSize_ (release/acquire).
+        return nodeSize != 0 && size <= nodeSize && alignment <= alignment_;
+    }
+
+    void SlabArena::Grow(std::size_t minNodes)
+    {
+        const std::size_t nodeSize = nodeSize_.load(std::memory_order_relaxed);
+        const std::size_t nodes = std::max(minNodes, nextSlabNodes_);
+        nextSlabNodes_ = std::min(nextSlabNodes_ * 2, MAX_SLAB_NODES);
+
+        // Залишок поточної плити не губиться: він переходить у список вільних.
+        while (cursor_ != slabEnd_)
+        {
+            auto* node = reinterpret_cast<FreeNode*>(cursor_);
+            node->next = freeList_;
+            freeList_ = node;
+            cursor_ += nodeSize;
+        }
+
+        const std::size_t bytes = nodes * nodeSize;
+        void* slab = ::operator new(bytes, std::align_val_t{alignment_});
+        slabs_.push_back(slab);
+        reservedBytes_ += bytes;
+        cursor_ = static_cast<std::byte*>(slab);
+        slabEnd_ = cursor_ + bytes;
+    }
+
+    SlabArena::FreeNode* SlabArena::TakeLocked()
+    {
+        if (freeList_)
+        {
+            FreeNode* node = freeList_;
+            freeList_ = node->next;
+            return node;
+        }
+        if (cursor_ == slabEnd_) Grow(1);
+
+        auto* node = reinterpret_cast<FreeNode*>(cursor_);
+        cursor_ += nodeSize_.load(std::memory_order_relaxed);
+        return node;
+    }
+
+    SlabArena::ThreadCache* SlabArena::LocalCache() noexcept
+    {
+        // Арен небагато (по одній на тип гравця), тож запаси — у невеликому
+        // масиві без динамічних виділень. Масив тривіально знищуваний і
+        // доступний до кінця потоку; вузли з нього повертає Flusher.
+        constexpr std::size_t MAX_CACHED_ARENAS = 8;
+        static thread_local ThreadCache caches[MAX_CACHED_ARENAS]{};
+        static thread_local bool retired = false;
+
+        if (retired) return nullptr;
+        for (ThreadCache& cache : caches)
+        {
+            if (cache.arena == this) return &cache;
+            if (cache.arena) continue;
+
+            struct Flusher
+            {
+                ThreadCache* caches;
+                bool* retired;
+
+                ~Flusher()
+                {
+                    // Після цього звільнення з потоку йдуть у спільний список.
+                    *retired = true;
+                    for (std::size_t i = 0; i < MAX_CACHED_ARENAS; ++i)
+                        if (caches[i].arena) caches[i].arena->Drain(caches[i], 0);
+                }
+            };
+            static thread_local Flusher flusher{caches, &retired};
+
+            cache.arena = this;
+            return &cache;
+        }
+        return nullptr;
+    }
+
+    void SlabArena::Refill(ThreadCache& cache)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (cache.count < CACHE_BATCH)
+        {
+            FreeNode* node = TakeLocked();
+            node->next = cache.head;
+            cache.head = node;
+            ++cache.count;
+        }
+    }
+
+    void SlabArena::Drain(ThreadCache& cache, std::size_t keep) noexcept
+    {
+        if (cache.count <= keep) return;
+
+        // Відрізаємо хвіст запасу і приєднуємо його до спільного списку.
+        FreeNode* last = cache.head;
+        for (std::size_t i = 1; i < cache.count - keep; ++i) last = last->next;
+        FreeNode* first = cache.head;
+        cache.head = last->next;
+        cache.count = keep;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        last->next = freeList_;
+        freeList_ = first;
+    }
+
+    void* SlabArena::Allocate(std::size_t size, std::size_t alignment)
+    {
+        std::size_t nodeSize = nodeSize_.load(std::memory_order_acquire);
+        if (nodeSize == 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            nodeSize = nodeSize_.load(std::memory_order_relaxed);
+            if (nodeSize == 0)
+            {
+                // Вузол має вміщати покажчик списку вільних і зберігати
+                // вирівнювання сусідніх вузлів.
+                alignment_ = std::max(alignment, alignof(FreeNode));
+                const std::size_t raw = std::max(size, sizeof(FreeNode));
+                nodeSize = (raw + alignment_ - 1) / alignment_ * alignment_;
+                nodeSize_.store(nodeSize, std::memory_order_release);
+            }
+        }
+        if (!FitsNode(nodeSize, size, alignment)) return nullptr;
+
+        liveNodes_.fetch_add(1, std::memory_order_relaxed);
+        ThreadCache* cache = LocalCache();
+        if (!cache)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return TakeLocked();
+        }
+
+        if (cache->count == 0) Refill(*cache);
+        FreeNode* node = cache->head;
+        cache->head = node->next;
+        --cache->count;
+        return node;
+    }
+
+    bool SlabArena::Fits(std::size_t size, std::size_t alignment) const
+    {
+        return FitsNode(nodeSize_.load(std::memory_order_acquire), size,
+                        alignment);
+    }
+
+    void SlabArena::Deallocate(void* node) noexcept
+    {
+        liveNodes_.fetch_sub(1, std::memory_order_relaxed);
+        auto* freeNode = static_cast<FreeNode*>(node);
+
+        ThreadCache* cache = LocalCache();
+        if (!cache)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            freeNode->next = freeList_;
+            freeList_ = freeNode;
+            return;
+        }
+
+        freeNode->next = cache->head;
+        cache->head = freeNode;
+        if (++cache->count >= 2 * CACHE_BATCH) Drain(*cache, CACHE_BATCH);
+    }
+
+    void SlabArena::Reserve(std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::size_t nodeSize = nodeSize_.load(std::memory_order_relaxed);
+        if (nodeSize == 0) return;
+
+        std::size_t available =
+            static_cast<std::size_t>(slabEnd_ - cursor_) / nodeSize;
+        for (const FreeNode* node = freeList_; node && available < count;
+             node = node->next)
+            ++available;
+        if (available < count) Grow(count - available);
+    }
+
+    SlabStats SlabArena::Stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {nodeSize_.load(std::memory_order_relaxed), slabs_.size(),
+                reservedBytes_, liveNodes_.load(std::memory_order_relaxed)};
+    }
+}
@@ -0,0 +1,174 @@
+#include "../include/StatusBitmap.h"
+#include <bit>
+
+namespace FootballManagement
+{
+    namespace
+    {
+        constexpr std::size_t WORD_BITS = 64;
+
+        constexpr std::uint64_t FlagBit(PlayerStatus flags, std::size_t plane)
+        {
+            return static_cast<std::uint32_t>(flags) >> plane & 1u;
+        }
+    }
+
+    void StatusBitmap::WriteBits(std::size_t slot, PlayerStatus flags)
+    {
+        const std::size_t word = slot / WORD_BITS;
+        const std::uint64_t bit = 1ull << slot % WORD_BITS;
+        for (std::size_t plane = 0; plane < PLAYER_STATUS_FLAG_COUNT; ++plane)
+        {
+            if (FlagBit(flags, plane))
+                planes_[plane][word] |= bit;
+            else
+                planes_[plane][word] &= ~bit;
+        }
+    }
+
+    void StatusBitmap::PushBack(PlayerStatus flags)
+    {
+        if (flags_.size() % WORD_BITS == 0)
+        {
+            for (auto& plane : planes_) plane.push_back(0);
+        }
+        flags_.push_back(flags);
+        WriteBits(flags_.size() - 1, flags);
+    }
+
+    void StatusBitmap::Set(std::size_t slot, PlayerStatus flags)
+    {
+        if (flags_[slot] == flags) return;
+        flags_[slot] = flags;
+        WriteBits(slot, flags);
+    }
+
+    PlayerStatus StatusBitmap::Get(std::size_t slot) const
+    {
+        return flags_[slot];
+    }
+
+    void StatusBitmap::Remove(std::size_t slot)
+    {
+        // Біти після slot зсуваються на один послівно; у кінець останнього
+        // слова входить нуль, тож хвіст слова лишається нульовим.
+        const std::size_t first = slot / WORD_BITS;
+        const std::uint64_t below = (1ull << slot % WORD_BITS) - 1;
+        for (auto& plane : planes_)
+        {
+            for (std::size_t word = first; word < plane.size(); ++word)
+            {
+                const std::uint64_t carry = word + 1 < plane.size()
+                                                ? plane[word + 1] << (WORD_BITS - 1)
+                                                : 0;
+                const std::uint64_t shifted = plane[word] >> 1 | carry;
+                plane[word] = word == first
+                                  ? (plane[word] & below) | (shifted & ~below)
+                                  : shifted;
+            }
+        }
+        flags_.erase(flags_.begin() + static_cast<std::ptrdiff_t>(slot));
+        if (flags_.size() % WORD_BITS == 0)
+        {
+            for (auto& plane : planes_) plane.pop_back();
+        }
+    }
+
+    void StatusBitmap::Clear()
+    {
+        flags_.clear();
+        for (auto& plane : planes_) plane.clear();
+    }
+
+    void StatusBitmap::Reserve(std::size_t count)
+    {
+        flags_.reserve(count);
+        for (auto& plane : planes_) plane.reserve((count + WORD_BITS - 1) / WORD_BITS);
+    }
+
+    std::size_t StatusBitmap::Size() const { return flags_.size(); }
+
+    template <typename Visitor>
+    void StatusBitmap::ForEachWord(const std::vector<StatusFilter>& anyOf,
+                                   Visitor&& visit) const
+    {
+        if (anyOf.empty() || flags_.empty()) return;
+
+        // Для кожного фільтра — площини, які беруться прямо або з запереченням.
+        struct PlaneTerm
+        {
+            const std::uint64_t* words;
+            std::uint64_t invert;
+        };
+        std::vector<std::vector<PlaneTerm>> terms(anyOf.size());
+        for (std::size_t f = 0; f < anyOf.size(); ++f)
+        {
+            for (std::size_t plane = 0; plane < PLAYER_STATUS_FLAG_COUNT; ++plane)
+            {
+                if (FlagBit(anyOf[f].required, plane))
+                    terms[f].push_back({planes_[plane].data(), 0});
+                if (FlagBit(anyOf[f].excluded, plane))
+                    terms[f].push_back({planes_[plane].data(), ~0ull});
+            }
+        }
+
+        const std::size_t wordCount = planes_[0].size();
+        const std::size_t tail = flags_.size() % WORD_BITS;
+        for (std::size_t word = 0; word < wordCount; ++word)
+        {
+            std::uint64_t matches = 0;
+            for (const auto& filterTerms : terms)
+            {
+                std::uint64_t bits = ~0ull;
+                for (const PlaneTerm& term : filterTerms)
+                    bits &= term.words[word] ^ term.invert;
+                matches |= bits;
+            }
+            if (word + 1 == wordCount && tail != 0)
+                matches &= (1ull << tail) - 1;
+            if (matches && !visit(word, matches)) return;
+        }
+    }
+
+    std::vector<std::size_t> StatusBitmap::Select(
+        const std::vector<StatusFilter>& anyOf) const
+    {
+        std::vector<std::size_t> slots;
+        ForEachWord(anyOf, [&slots](std::size_t word, std::uint64_t bits)
+        {
+            while (bits)
+            {
+                slots.push_back(word * WORD_BITS + std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+            return true;
+        });
+        return slots;
+    }
+
+    void StatusBitmap::ForEachSlot(
+        const std::vector<StatusFilter>& anyOf,
+        const std::function<bool(std::size_t)>& visit) const
+    {
+        ForEachWord(anyOf, [&visit](std::size_t word, std::uint64_t bits)
+        {
+            for (; bits; bits &= bits - 1)
+            {
+                if (!visit(word * WORD_BITS + std::countr_zero(bits)))
+                    return false;
+            }
+            return true;
+        });
+    }
+
+    std::size_t StatusBitmap::Count(const std::vector<StatusFilter>& anyOf) const
+    {
+        std::size_t count = 0;
+        ForEachWord(anyOf, [&count](std::size_t, std::uint64_t bits)
+        {
+            count += static_cast<std::size_t>(std::popcount(bits));
+            return true;
+        });
+        return count;
+    }
+}
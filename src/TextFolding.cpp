@@ -0,0 +1,165 @@
+#include "../include/TextFolding.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace FootballManagement
+{
+    namespace
+    {
+        /// @brief Кодові точки, що кодуються двома байтами і мають таблицю перетворення.
+        constexpr std::size_t FOLD_TABLE_SIZE = 0x500;
+
+        constexpr std::array<std::uint16_t, FOLD_TABLE_SIZE> BuildFoldTable()
+        {
+            std::array<std::uint16_t, FOLD_TABLE_SIZE> table{};
+            for (std::size_t cp = 0; cp < FOLD_TABLE_SIZE; ++cp)
+                table[cp] = static_cast<std::uint16_t>(cp);
+
+            for (std::size_t cp = 'A'; cp <= 'Z'; ++cp) table[cp] = cp + 0x20;
+
+            // Latin-1: À..Þ, крім знака множення ×.
+            for (std::size_t cp = 0xC0; cp <= 0xDE; ++cp)
+            {
+                if (cp != 0xD7) table[cp] = cp + 0x20;
+            }
+
+            // Latin Extended-A: пари "велика, мала" з кількома зсувами парності.
+            for (std::size_t cp = 0x100; cp <= 0x137; cp += 2)
+            {
+                if (cp != 0x130) table[cp] = cp + 1;
+            }
+            for (std::size_t cp = 0x139; cp <= 0x148; cp += 2) table[cp] = cp + 1;
+            for (std::size_t cp = 0x14A; cp <= 0x177; cp += 2) table[cp] = cp + 1;
+            table[0x178] = 0xFF;
+            for (std::size_t cp = 0x179; cp <= 0x17E; cp += 2) table[cp] = cp + 1;
+
+            // Грецька: Α..Ω (0x3A2 не призначено).
+            for (std::size_t cp = 0x391; cp <= 0x3AB; ++cp)
+            {
+                if (cp != 0x3A2) table[cp] = cp + 0x20;
+            }
+
+            // Кирилиця: Ѐ..Џ (включно з Є, І, Ї), А..Я, історичні та
+            // розширені літери парами (включно з Ґ).
+            for (std::size_t cp = 0x400; cp <= 0x40F; ++cp) table[cp] = cp + 0x50;
+            for (std::size_t cp = 0x410; cp <= 0x42F; ++cp) table[cp] = cp + 0x20;
+            for (std::size_t cp = 0x460; cp <= 0x481; cp += 2) table[cp] = cp + 1;
+            for (std::size_t cp = 0x48A; cp <= 0x4BF; cp += 2) table[cp] = cp + 1;
+            table[0x4C0] = 0x4CF;
+            for (std::size_t cp = 0x4C1; cp <= 0x4CE; cp += 2) table[cp] = cp + 1;
+            for (std::size_t cp = 0x4D0; cp <= 0x4FF; cp += 2) table[cp] = cp + 1;
+
+            return table;
+        }
+
+        constexpr std::array<std::uint16_t, FOLD_TABLE_SIZE> FOLD_TABLE =
+            BuildFoldTable();
+
+        static_assert(FOLD_TABLE[0x0404] == 0x0454, "Є -> є");
+        static_assert(FOLD_TABLE[0x0406] == 0x0456, "І -> і");
+        static_assert(FOLD_TABLE[0x0407] == 0x0457, "Ї -> ї");
+        static_assert(FOLD_TABLE[0x0490] == 0x0491, "Ґ -> ґ");
+        static_assert(FOLD_TABLE[0x042F] == 0x044F, "Я -> я");
+
+        /**
+         * @brief Приводить до нижнього регістру блок чистого ASCII.
+         * @return Кількість оброблених байтів (зупиняється перед першим не-ASCII блоком).
+         */
+        std::size_t FoldAsciiBlocks(char* data, std::size_t size)
+        {
+            std::size_t i = 0;
+#if defined(__SSE2__)
+            const __m128i beforeA = _mm_set1_epi8('A' - 1);
+            const __m128i afterZ = _mm_set1_epi8('Z' + 1);
+            const __m128i caseBit = _mm_set1_epi8(0x20);
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i chunk = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i));
+                if (_mm_movemask_epi8(chunk) != 0) return i;
+
+                const __m128i upper = _mm_and_si128(
+                    _mm_cmpgt_epi8(chunk, beforeA), _mm_cmplt_epi8(chunk, afterZ));
+                chunk = _mm_add_epi8(chunk, _mm_and_si128(upper, caseBit));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), chunk);
+            }
+#endif
+            // SWAR: 8 байтів за крок. Для ASCII-байта b старший біт
+            // (b + 0x3F) встановлений, якщо b >= 'A', а (b + 0x25) — якщо b > 'Z'.
+            constexpr std::uint64_t ones = 0x0101010101010101ull;
+            constexpr std::uint64_t highBits = 0x8080808080808080ull;
+            for (; i + 8 <= size; i += 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                if (word & highBits) return i;
+
+                const std::uint64_t atLeastA = word + ones * (0x80 - 'A');
+                const std::uint64_t aboveZ = word + ones * (0x80 - 'Z' - 1);
+                const std::uint64_t upper = (atLeastA & ~aboveZ) & highBits;
+                word |= upper >> 2;
+                std::memcpy(data + i, &word, sizeof(word));
+            }
+            return i;
+        }
+    }
+
+    void FoldCaseInPlace(std::string& text)
+    {
+        char* data = text.data();
+        const std::size_t size = text.size();
+        std::size_t i = 0;
+
+        while (i < size)
+        {
+            i += FoldAsciiBlocks(data + i, size - i);
+
+            // Блок із не-ASCII байтами (або короткий хвіст) обробляється
+            // посимвольно; потім знову пробуємо векторний шлях.
+            const std::size_t blockEnd = std::min(i + 16, size);
+            while (i < blockEnd)
+            {
+                const auto lead = static_cast<unsigned char>(data[i]);
+                if (lead < 0x80)
+                {
+                    if (lead >= 'A' && lead <= 'Z')
+                        data[i] = static_cast<char>(lead + 0x20);
+                    ++i;
+                    continue;
+                }
+
+                // Двобайтова послідовність 110xxxxx 10xxxxxx (U+0080..U+07FF).
+                if ((lead & 0xE0) == 0xC0 && i + 1 < size &&
+                    (static_cast<unsigned char>(data[i + 1]) & 0xC0) == 0x80)
+                {
+                    const std::uint32_t cp = (lead & 0x1Fu) << 6 |
+                        (static_cast<unsigned char>(data[i + 1]) & 0x3Fu);
+                    if (cp < FOLD_TABLE_SIZE)
+                    {
+                        const std::uint16_t folded = FOLD_TABLE[cp];
+                        data[i] = static_cast<char>(0xC0 | folded >> 6);
+                        data[i + 1] = static_cast<char>(0x80 | (folded & 0x3F));
+                    }
+                    i += 2;
+                    continue;
+                }
+
+                // Інші символи (3-4 байти) та некоректні байти не змінюються.
+                ++i;
+            }
+        }
+    }
+
+    std::string FoldCase(std::string_view text)
+    {
+        std::string folded(text);
+        FoldCaseInPlace(folded);
+        return folded;
+    }
+}
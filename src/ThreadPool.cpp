@@ -0,0 +1,58 @@
+#include "../include/ThreadPool.h"
+#include <algorithm>
+
+namespace FootballManagement
+{
+    ThreadPool::ThreadPool(std::size_t threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        workers_.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i)
+            workers_.emplace_back([this] { WorkerLoop(); });
+    }
+
+    ThreadPool::~ThreadPool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        available_.notify_all();
+        for (std::thread& worker : workers_) worker.join();
+    }
+
+    std::size_t ThreadPool::ThreadCount() const { return workers_.size(); }
+
+    void ThreadPool::Enqueue(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        available_.notify_one();
+    }
+
+    void ThreadPool::WorkerLoop()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) return;
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    ThreadPool& ThreadPool::Shared()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+}
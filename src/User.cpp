@@ -1,9 +1,9 @@
 #include "../include/User.h"
+#include "../include/RecordParser.h"
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
-#include <vector>
 
 namespace FootballManagement
 {
@@ -145,31 +145,37 @@ namespace FootballManagement
 
     std::string User::Serialize() const
     {
-        std::stringstream ss;
-        ss << userName_ << ":" << password_ << ":"
-            << static_cast<int>(userRole_);
-        return ss.str();
+        OutputBuffer out;
+        AppendTo(out);
+        return out.Take();
+    }
+
+    void User::AppendTo(OutputBuffer& out) const
+    {
+        out.Append(userName_).Append(':').Append(password_).Append(':')
+           .AppendInt(static_cast<int>(userRole_));
     }
 
     void User::Deserialize(const std::string& data)
+    {
+        DeserializeRecord(data);
+    }
+
+    void User::DeserializeRecord(std::string_view data)
     {
         try
         {
-            std::stringstream ss(data);
-            std::string token;
-            std::vector<std::string> parts;
-
-            while (std::getline(ss, token, ':'))
-                parts.push_back(token);
+            const std::size_t first = data.find(':');
+            const std::size_t second = first == std::string_view::npos
+                                           ? std::string_view::npos
+                                           : data.find(':', first + 1);
 
-            if (parts.size() != 3)
+            if (second == std::string_view::npos ||
+                data.find(':', second + 1) != std::string_view::npos)
                 throw std::runtime_error(
                     "Некоректний формат рядка користувача (очікується 3 частини).");
 
-            userName_ = parts[0];
-            password_ = parts[1];
-
-            int roleInt = std::stoi(parts[2]);
+            const int roleInt = RecordParser::ParseInt(data.substr(second + 1));
             switch (roleInt)
             {
             case 0: userRole_ = UserRole::Admin;
@@ -180,6 +186,9 @@ namespace FootballManagement
                 break;
             default: throw std::out_of_range("Невідома роль.");
             }
+
+            userName_.assign(data.substr(0, first));
+            password_.assign(data.substr(first + 1, second - first - 1));
         }
         catch (const std::exception& e)
         {
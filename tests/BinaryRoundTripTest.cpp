@@ -0,0 +1,70 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "BenchFixtures.h"
+#include "BinaryIO.h"
+#include "ClubManager.h"
+#include "TestSupport.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int PLAYER_COUNT = 300;
+
+    /** @brief Чи кидає завантаження пошкоджених даних, не змінюючи склад. */
+    bool RejectsIntact(ClubManager& club, const std::string& data)
+    {
+        const std::string before = club.Serialize();
+        try
+        {
+            club.DeserializeBinary(data);
+        }
+        catch (const std::runtime_error&)
+        {
+            return club.Serialize() == before;
+        }
+        return false;
+    }
+}
+
+int main()
+{
+    TestContext test;
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager source("Round Trip FC", 1234567.5);
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+            source.AddPlayer(MakePlayer(i));
+        source.ModifyPlayer(FIRST_PLAYER_ID + 4, [](Player& player)
+        {
+            player.ReportInjury("Розтягнення", 14);
+        });
+        source.RemovePlayers(FIRST_PLAYER_ID + 7);
+
+        const std::string data = source.SerializeBinary();
+        test.Check(BinaryReader::HasMagic(data), "бінарний знімок має сигнатуру");
+
+        ClubManager loaded;
+        loaded.DeserializeBinary(data);
+        test.Check(loaded.Serialize() == source.Serialize(),
+                   "бінарний знімок відтворює склад запис у запис");
+        test.Check(loaded.GetNextId() == source.GetNextId(),
+                   "бінарний знімок зберігає наступний ID");
+        test.Check(loaded.SerializeBinary() == data,
+                   "повторне збереження дає той самий бінарний знімок");
+
+        // Обрізаний файл: склад лишається попереднім.
+        test.Check(RejectsIntact(loaded, data.substr(0, data.size() / 2)),
+                   "обрізаний знімок відхиляється без зміни складу");
+
+        // Таблиця рядків, більша за решту файлу.
+        std::string hugeTable = data.substr(0, BINARY_SNAPSHOT_MAGIC.size() + 4);
+        hugeTable += std::string("\xff\xff\xff\xff", 4);
+        test.Check(RejectsIntact(loaded, hugeTable),
+                   "завелика кількість рядків відхиляється до резервування");
+    }
+    std::cout.rdbuf(original);
+    return test.Finish();
+}
@@ -0,0 +1,100 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "FileManager.h"
+#include "RosterJournal.h"
+#include "TestSupport.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    const std::string SNAPSHOT_FILE = "test_journal.json";
+    const std::string JOURNAL_FILE = "test_journal.journal";
+    constexpr int PLAYER_COUNT = 100;
+
+    std::string Recovered(const FileManager& fileManager)
+    {
+        ClubManager club;
+        RosterJournal(fileManager, 1000, SNAPSHOT_FILE, JOURNAL_FILE).Recover(club);
+        return club.Serialize();
+    }
+
+    std::string ReadFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    void WriteFile(const std::string& path, const std::string& data)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << data;
+    }
+}
+
+int main()
+{
+    TestContext test;
+    FileManager fileManager;
+    const std::string snapshotPath = fileManager.GetFullPath(SNAPSHOT_FILE);
+    const std::string journalPath = fileManager.GetFullPath(JOURNAL_FILE);
+
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        auto journal = std::make_shared<RosterJournal>(
+            fileManager, 1000, SNAPSHOT_FILE, JOURNAL_FILE);
+        ClubManager club("Journal FC", 500000.0);
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+            club.AddPlayer(MakePlayer(i));
+        club.AttachJournal(journal);
+        test.Check(journal->Compact(club), "початковий знімок записано");
+
+        club.ModifyPlayer(FIRST_PLAYER_ID + 1, [](Player& player)
+        {
+            player.SetMarketValue(777777.0);
+        });
+        club.RemovePlayers(FIRST_PLAYER_ID + 2);
+        club.AddPlayer(MakePlayer(PLAYER_COUNT));
+        // Дробовий бюджет: журнал має відтворити його точно, а не з 6 знаками.
+        club.SetTransferBudget(400000.123456789);
+        const std::string beforeLast = club.Serialize();
+        const std::string journalBeforeLast = ReadFile(journalPath);
+
+        club.RenamePlayer(FIRST_PLAYER_ID + 3, "Перейменований");
+        const std::string final = club.Serialize();
+        const std::string fullJournal = ReadFile(journalPath);
+        const std::string snapshot = ReadFile(snapshotPath);
+        test.Check(fullJournal.size() > journalBeforeLast.size(),
+                   "остання зміна дописана в журнал");
+
+        // Повний журнал поверх знімка дає поточний склад.
+        test.Check(SortedRecords(Recovered(fileManager)) == SortedRecords(final),
+                   "програвання повного журналу відновлює склад");
+
+        // Запис, обірваний посередині (збій під час дописування),
+        // пропускається, а попередні зміни застосовуються.
+        WriteFile(snapshotPath, snapshot);
+        WriteFile(journalPath, fullJournal.substr(
+            0, journalBeforeLast.size() + (fullJournal.size() -
+                journalBeforeLast.size()) / 2));
+        test.Check(SortedRecords(Recovered(fileManager)) == SortedRecords(beforeLast),
+                   "обірваний останній запис журналу пропускається");
+
+        // Відновлення ущільнило журнал у знімок.
+        test.Check(std::filesystem::file_size(journalPath) == 0,
+                   "після відновлення журнал ущільнено");
+        test.Check(SortedRecords(Recovered(fileManager)) == SortedRecords(beforeLast),
+                   "ущільнений знімок відновлюється без журналу");
+    }
+    std::cout.rdbuf(original);
+
+    std::filesystem::remove(snapshotPath);
+    std::filesystem::remove(journalPath);
+    return test.Finish();
+}
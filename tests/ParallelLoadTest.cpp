@@ -0,0 +1,55 @@
+#include <iostream>
+#include <string>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "RecordSources.h"
+#include "TestSupport.h"
+#include "ThreadPool.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int PLAYER_COUNT = 20000;
+}
+
+int main()
+{
+    TestContext test;
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager source("Parallel FC", 2500000.0);
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+            source.AddPlayer(MakePlayer(i));
+
+        // Пошкоджений запис і повторний ID посередині файлу мають
+        // пропускатися однаково в обох шляхах.
+        std::string text = source.Serialize();
+        const std::size_t middle = text.find('\n', text.size() / 2) + 1;
+        const std::size_t next = text.find('\n', middle) + 1;
+        text.insert(next, text.substr(middle, next - middle));
+        text.insert(middle, "{\"type\":\"unknown\"}\n");
+
+        ClubManager sequential;
+        LineRange lines(text);
+        sequential.DeserializeAllPlayers(lines);
+
+        ThreadPool pool(4);
+        ClubManager parallel;
+        parallel.DeserializeAllPlayersParallel(text, pool);
+
+        test.Check(sequential.GetPlayerCount() ==
+                       static_cast<std::size_t>(PLAYER_COUNT),
+                   "послідовне завантаження пропускає пошкоджені й повторні записи");
+        test.Check(parallel.Serialize() == sequential.Serialize(),
+                   "паралельне завантаження дає той самий склад у тому ж порядку");
+        test.Check(parallel.GetNextId() == sequential.GetNextId(),
+                   "паралельне завантаження відновлює наступний ID");
+        test.Check(parallel.SearchByName("Гравець 1234").size() ==
+                       sequential.SearchByName("Гравець 1234").size(),
+                   "іменний індекс паралельного завантаження повний");
+    }
+    std::cout.rdbuf(original);
+    return test.Finish();
+}
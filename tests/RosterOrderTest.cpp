@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "TestSupport.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int PLAYER_COUNT = 200;
+    /// @brief Початок, сусідні слоти, середина й кінець складу; 0, 57 і 120 — воротарі.
+    constexpr std::array<int, 5> REMOVED = {0, 57, 58, PLAYER_COUNT - 1, 120};
+
+    /** @brief Рядки знімка в порядку складу. */
+    std::vector<std::string> Records(const std::string& text)
+    {
+        std::vector<std::string> records;
+        std::size_t begin = 0;
+        while (begin < text.size())
+        {
+            std::size_t end = text.find('\n', begin);
+            if (end == std::string::npos) end = text.size();
+            records.emplace_back(text, begin, end - begin);
+            begin = end + 1;
+        }
+        return records;
+    }
+}
+
+int main()
+{
+    TestContext test;
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Order FC", 1000000.0);
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+            club.AddPlayer(MakePlayer(i));
+
+        std::vector<std::string> expected = Records(club.Serialize());
+        const RosterSnapshot before = club.Snapshot();
+        for (const int index : REMOVED)
+        {
+            const int playerId = FIRST_PLAYER_ID + index;
+            std::erase(expected, club.FindById(playerId)->Serialize());
+            club.RemovePlayers(playerId);
+        }
+
+        test.Check(Records(club.Serialize()) == expected,
+                   "видалення зберігає порядок решти гравців");
+        test.Check(before.Size() == static_cast<std::size_t>(PLAYER_COUNT),
+                   "знімок до видалень не змінився");
+
+        bool indexed = true;
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+        {
+            const bool removed =
+                std::find(REMOVED.begin(), REMOVED.end(), i) != REMOVED.end();
+            const auto player = club.FindById(FIRST_PLAYER_ID + i);
+            indexed = indexed && (removed
+                                      ? !player
+                                      : player && player->GetPlayerId() ==
+                                      FIRST_PLAYER_ID + i);
+        }
+        test.Check(indexed, "індекс за ID відповідає зсунутим слотам");
+
+        // Бітові площини статусів зсуваються разом зі слотами.
+        const std::vector<Player*> keepers =
+            club.FilterByStatus(PlayerStatus::Goalkeeper);
+        const bool allKeepers = std::all_of(keepers.begin(), keepers.end(),
+                                            [](const Player* player)
+                                            {
+                                                return HasStatus(
+                                                    player->GetStatusFlags(),
+                                                    PlayerStatus::Goalkeeper);
+                                            });
+        test.Check(allKeepers && keepers.size() ==
+                       static_cast<std::size_t>((PLAYER_COUNT + 2) / 3 - 3),
+                   "фільтр статусів після видалень повертає саме воротарів");
+    }
+    std::cout.rdbuf(original);
+    return test.Finish();
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "BenchFixtures.h"
+#include "ClubManager.h"
+#include "OutputBuffer.h"
+#include "RosterSnapshot.h"
+#include "TestSupport.h"
+
+using namespace FootballManagement;
+
+namespace
+{
+    constexpr int PLAYER_COUNT = 60;
+
+    /** @brief Записи гравців знімка в порядку слотів. */
+    std::string Records(const RosterSnapshot& snapshot)
+    {
+        OutputBuffer out;
+        snapshot.ForEach([&out](const Player& player)
+        {
+            player.AppendTo(out);
+            out.Append('\n');
+        });
+        return out.Take();
+    }
+}
+
+int main()
+{
+    TestContext test;
+    std::streambuf* original = std::cout.rdbuf(nullptr);
+    {
+        ClubManager club("Snapshot FC", 10000000.0);
+        for (int i = 0; i < PLAYER_COUNT; ++i)
+            club.AddPlayer(MakePlayer(i));
+
+        const RosterSnapshot snapshot = club.Snapshot();
+        const std::string before = Records(snapshot);
+        const std::shared_ptr<Player> held = club.FindById(FIRST_PLAYER_ID);
+
+        // MakePlayer(1) — вільний агент (i % 3 == 1).
+        const int agentId = FIRST_PLAYER_ID + 1;
+        club.ModifyPlayer(FIRST_PLAYER_ID, [](Player& player)
+        {
+            player.SetMarketValue(999999.0);
+        });
+        club.RenamePlayer(FIRST_PLAYER_ID + 5, "Новий підпис");
+        club.RemovePlayers(FIRST_PLAYER_ID + 8);
+        club.AddPlayer(MakePlayer(PLAYER_COUNT));
+        club.SetTransferBudget(9000000.0);
+        test.Check(club.SignFreeAgent(std::dynamic_pointer_cast<FreeAgent>(
+                       club.FindById(agentId)), 50000.0, "2030-06-30"),
+                   "вільного агента підписано");
+
+        test.Check(Records(snapshot) == before,
+                   "знімок не бачить змін, зроблених після нього");
+        test.Check(snapshot.Size() == static_cast<std::size_t>(PLAYER_COUNT),
+                   "розмір знімка не змінився");
+        test.Check(snapshot.GetTransferBudget() == 10000000.0,
+                   "бюджет знімка не змінився");
+        test.Check(snapshot.FindById(FIRST_PLAYER_ID + 8) != nullptr,
+                   "видалений після знімка гравець лишається в ньому");
+
+        test.Check(club.FindById(FIRST_PLAYER_ID)->GetMarketValue() == 999999.0,
+                   "склад бачить зміну через ModifyPlayer");
+        test.Check(held->GetMarketValue() != 999999.0,
+                   "покажчик, узятий до зміни, показує стан до неї");
+        test.Check(!club.FindById(FIRST_PLAYER_ID + 8), "гравця видалено зі складу");
+        test.Check(club.Snapshot().GetTransferBudget() < 9000000.0,
+                   "новий знімок бачить витрату бюджету на підписання");
+    }
+    std::cout.rdbuf(original);
+    return test.Finish();
+}
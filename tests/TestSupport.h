@@ -0,0 +1,32 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+namespace FootballManagement
+{
+    /**
+     * @brief Лічильник перевірок тесту: провалені перевірки друкуються в
+     * std::cerr (std::cout тести вимикають, щоб не бачити журналу менеджера).
+     */
+    class TestContext
+    {
+    private:
+        int failures_ = 0;
+
+    public:
+        /** @brief Фіксує перевірку; what описує очікувану властивість. */
+        void Check(bool ok, const std::string& what)
+        {
+            if (ok) return;
+            ++failures_;
+            std::cerr << "[ПОМИЛКА] " << what << "\n";
+        }
+
+        /** @brief Код завершення для ctest: 0, якщо всі перевірки пройшли. */
+        [[nodiscard]] int Finish() const
+        {
+            return failures_ == 0 ? 0 : 1;
+        }
+    };
+}